@@ -72,7 +72,10 @@ void URavenPoolActorFactory::PrepareForStorage_Implementation(UObject* Object)
 		return;
 	}
 
-	Actor->SetActorLocation(StorageLocation);
+	if (StorageMode == ERavenPoolActorStorageMode::StorageLocation)
+	{
+		Actor->SetActorLocation(StorageLocation);
+	}
 	Actor->SetActorHiddenInGame(true);
 	Actor->SetActorEnableCollision(false);
 	Actor->SetActorTickEnabled(false);
@@ -80,15 +83,13 @@ void URavenPoolActorFactory::PrepareForStorage_Implementation(UObject* Object)
 	// Optionally disable components
 	if (bDisableComponents)
 	{
-		TArray<UActorComponent*> Components;
-		Actor->GetComponents(Components);
-		for (UActorComponent* Component : Components)
+		Actor->ForEachComponent(false, [](UActorComponent* Component)
 		{
-			if (Component && Component->IsActive())
+			if (Component->IsActive())
 			{
 				Component->Deactivate();
 			}
-		}
+		});
 	}
 }
 
@@ -104,7 +105,7 @@ void URavenPoolActorFactory::PrepareForUsage_Implementation(UObject* Object)
 		return;
 	}
 
-	// Note: Location should be set by the caller after acquiring the actor
+	// Acquisitions with a transform (AcquireAt) have already placed the actor, so it activates where it is used
 	Actor->SetActorHiddenInGame(false);
 	Actor->SetActorEnableCollision(true);
 	Actor->SetActorTickEnabled(true);
@@ -112,15 +113,13 @@ void URavenPoolActorFactory::PrepareForUsage_Implementation(UObject* Object)
 	// Optionally re-enable components
 	if (bDisableComponents)
 	{
-		TArray<UActorComponent*> Components;
-		Actor->GetComponents(Components);
-		for (UActorComponent* Component : Components)
+		Actor->ForEachComponent(false, [](UActorComponent* Component)
 		{
-			if (Component && !Component->IsActive())
+			if (!Component->IsActive())
 			{
 				Component->Activate();
 			}
-		}
+		});
 	}
 }
 
@@ -0,0 +1,181 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenConcurrentPool.h"
+#include "Pool/Factory/RavenPoolFactoryUObject.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRavenConcurrentPool, Log, All);
+
+FRavenConcurrentPool::FRavenConcurrentPool(UClass* InObjectClass, URavenPoolFactoryUObject* InFactory)
+	: TlsSlot(FPlatformTLS::AllocTlsSlot())
+	, ObjectClass(InObjectClass)
+	, Factory(InFactory)
+{
+	check(FPlatformTLS::IsValidTlsSlot(TlsSlot));
+}
+
+FRavenConcurrentPool::~FRavenConcurrentPool()
+{
+	// Thread caches and magazines are owned by the ownership lists, the lists only link them
+	while (FullMagazines.Pop())
+	{
+	}
+	while (EmptyMagazines.Pop())
+	{
+	}
+
+	FPlatformTLS::FreeTlsSlot(TlsSlot);
+}
+
+UObject* FRavenConcurrentPool::Acquire()
+{
+	FThreadCache& Cache = GetThreadCache();
+	if (Cache.Loaded->Num == 0)
+	{
+		if (Cache.Previous->Num > 0)
+		{
+			Swap(Cache.Loaded, Cache.Previous);
+		}
+		else if (FMagazine* Full = FullMagazines.Pop())
+		{
+			// Both magazines are empty, trade one of them for a full one
+			EmptyMagazines.Push(Cache.Previous);
+			Cache.Previous = Cache.Loaded;
+			Cache.Loaded = Full;
+		}
+		else
+		{
+			PendingMisses.fetch_add(1, std::memory_order_relaxed);
+			TotalMisses.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+	}
+
+	return Cache.Loaded->Objects[--Cache.Loaded->Num];
+}
+
+void FRavenConcurrentPool::Release(UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	FThreadCache& Cache = GetThreadCache();
+	if (Cache.Loaded->Num == MagazineSize)
+	{
+		if (Cache.Previous->Num == 0)
+		{
+			Swap(Cache.Loaded, Cache.Previous);
+		}
+		else
+		{
+			// Both magazines are full, hand one to the depot
+			FullMagazines.Push(Cache.Previous);
+			Cache.Previous = Cache.Loaded;
+			Cache.Loaded = PopEmptyMagazine();
+		}
+	}
+
+	Cache.Loaded->Objects[Cache.Loaded->Num++] = Object;
+}
+
+int32 FRavenConcurrentPool::PreWarm(const int32 Count)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(Factory) || !IsValid(ObjectClass) || Count <= 0)
+	{
+		return 0;
+	}
+
+	// Whole magazines, except for a last partial one that fills the pool up to its max size
+	int32 NumToCreate = FMath::DivideAndRoundUp(Count, MagazineSize) * MagazineSize;
+	if (MaxPoolSize > 0)
+	{
+		NumToCreate = FMath::Clamp(MaxPoolSize - AllObjects.Num(), 0, NumToCreate);
+	}
+
+	const int32 InitialSize = AllObjects.Num();
+	AllObjects.Reserve(InitialSize + NumToCreate);
+
+	int32 NumCreated = 0;
+	bool bCreationFailed = false;
+	while (NumCreated < NumToCreate && !bCreationFailed)
+	{
+		FMagazine* Magazine = PopEmptyMagazine();
+		while (Magazine->Num < MagazineSize && NumCreated < NumToCreate)
+		{
+			UObject* Object = Factory->CreatePoolObject(ObjectClass);
+			if (!IsValid(Object))
+			{
+				UE_LOG(LogRavenConcurrentPool, Error, TEXT("Failed to create object of class %s for concurrent pool"), *ObjectClass->GetName());
+				bCreationFailed = true;
+				break;
+			}
+
+			AllObjects.Add(Object);
+			Magazine->Objects[Magazine->Num++] = Object;
+			NumCreated++;
+		}
+
+		// A partial magazine is only ever loaded by a thread, so its cached previous magazine stays full or empty
+		if (Magazine->Num > 0)
+		{
+			FullMagazines.Push(Magazine);
+		}
+		else
+		{
+			EmptyMagazines.Push(Magazine);
+		}
+	}
+
+	return AllObjects.Num() - InitialSize;
+}
+
+void FRavenConcurrentPool::Tick()
+{
+	if (PendingMisses.exchange(0, std::memory_order_relaxed) > 0)
+	{
+		const int32 Created = PreWarm(MagazineSize);
+		UE_LOG(LogRavenConcurrentPool, Verbose, TEXT("Concurrent pool for class %s ran dry, created %d objects (Pool size: %d)"),
+			*GetNameSafe(ObjectClass), Created, AllObjects.Num());
+	}
+}
+
+void FRavenConcurrentPool::AddReferencedObjects(FReferenceCollector& Collector, const UObject* ReferencingObject)
+{
+	Collector.AddReferencedObject(ObjectClass, ReferencingObject);
+	Collector.AddReferencedObject(Factory, ReferencingObject);
+	Collector.AddReferencedObjects(AllObjects, ReferencingObject);
+}
+
+FRavenConcurrentPool::FThreadCache& FRavenConcurrentPool::CreateThreadCache()
+{
+	TUniquePtr<FThreadCache> NewCache = MakeUnique<FThreadCache>();
+	NewCache->Loaded = PopEmptyMagazine();
+	NewCache->Previous = PopEmptyMagazine();
+
+	FThreadCache& Cache = *NewCache;
+	{
+		FScopeLock Lock(&OwnershipLock);
+		ThreadCaches.Add(MoveTemp(NewCache));
+	}
+
+	FPlatformTLS::SetTlsValue(TlsSlot, &Cache);
+	return Cache;
+}
+
+FRavenConcurrentPool::FMagazine* FRavenConcurrentPool::PopEmptyMagazine()
+{
+	if (FMagazine* Magazine = EmptyMagazines.Pop())
+	{
+		return Magazine;
+	}
+
+	TUniquePtr<FMagazine> NewMagazine = MakeUnique<FMagazine>();
+	FMagazine* Magazine = NewMagazine.Get();
+
+	FScopeLock Lock(&OwnershipLock);
+	AllMagazines.Add(MoveTemp(NewMagazine));
+	return Magazine;
+}
@@ -3,29 +3,20 @@
 #include "Pool/RavenPool.h"
 #include "Pool/Factory/RavenPoolFactoryUObject.h"
 #include "Pool/Strategy/RavenPoolStrategy.h"
-#include "Pool/Interface/Poolable.h"
 #include "Pool/RavenPoolStats.h"
+#include "Pool/RavenPoolAllocationCheck.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogRavenPool, Log, All);
 
-bool FRavenPoolEntry::Validate() const
+namespace RavenPool
 {
-	if (!IsValid(Object))
-	{
-		return false;
-	}
-
-	// Check if object implements IPoolable and ask if it's valid for reuse
-	if (Object->Implements<UPoolable>())
-	{
-		IPoolable* Poolable = Cast<IPoolable>(Object);
-		if (Poolable && !Poolable->Execute_IsValidForReuse(Object))
-		{
-			return false;
-		}
-	}
+	/** Seconds between two demand samples of adaptive sizing */
+	constexpr double AdaptiveSampleInterval = 1.0;
 
-	return true;
+	/** Seconds between two checks for transient objects destroyed outside the pool */
+	constexpr double TransientPruneInterval = 1.0;
 }
 
 FRavenPool::FRavenPool(UClass* InObjectClass)
@@ -36,80 +27,132 @@ FRavenPool::FRavenPool(UClass* InObjectClass)
 }
 
 UObject* FRavenPool::Acquire()
+{
+	FRavenPoolSlotId SlotId;
+	return AcquireInternal(nullptr, [](UObject*) {}, SlotId, true);
+}
+
+UObject* FRavenPool::Acquire(FRavenPoolSlotId& OutSlotId)
+{
+	return AcquireInternal(nullptr, [](UObject*) {}, OutSlotId, false);
+}
+
+UObject* FRavenPool::AcquireNear(const FVector& Location)
+{
+	FRavenPoolSlotId SlotId;
+	return AcquireInternal(&Location, [](UObject*) {}, SlotId, true);
+}
+
+UObject* FRavenPool::AcquireNear(const FVector& Location, FRavenPoolSlotId& OutSlotId)
+{
+	return AcquireInternal(&Location, [](UObject*) {}, OutSlotId, false);
+}
+
+UObject* FRavenPool::AcquireAt(const FTransform& Transform, const TFunctionRef<void(UObject*)> Initializer)
+{
+	FRavenPoolSlotId SlotId;
+	return AcquireAtInternal(Transform, Initializer, SlotId, true);
+}
+
+UObject* FRavenPool::AcquireAt(const FTransform& Transform, const TFunctionRef<void(UObject*)> Initializer, FRavenPoolSlotId& OutSlotId)
+{
+	return AcquireAtInternal(Transform, Initializer, OutSlotId, false);
+}
+
+UObject* FRavenPool::AcquireAtInternal(const FTransform& Transform, const TFunctionRef<void(UObject*)> Initializer, FRavenPoolSlotId& OutSlotId,
+                                       const bool bAllowTransient)
+{
+	const FVector Location = Transform.GetLocation();
+	return AcquireInternal(&Location, [&Transform, &Initializer](UObject* Object)
+	{
+		ApplyTransform(Object, Transform);
+		Initializer(Object);
+	}, OutSlotId, bAllowTransient);
+}
+
+UObject* FRavenPool::AcquireInternal(const FVector* Location, const TFunctionRef<void(UObject*)> PrepareDormant, FRavenPoolSlotId& OutSlotId,
+                                     const bool bAllowTransient)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Pool_Acquire);
 
+	OutSlotId = FRavenPoolSlotId();
+
 	if (!IsValid(Factory) || !IsValid(ObjectClass))
 	{
 		UE_LOG(LogRavenPool, Error, TEXT("Cannot acquire object: Factory or ObjectClass is invalid"));
 		return nullptr;
 	}
 
-	// Rebuild inactive indices if needed
-	if (bInactiveIndicesDirty)
+	// Try to reuse an inactive object from the pool, discarding any that fail validation
+	int32 InactiveIndex = FindInactiveObject(Location);
+	while (InactiveIndex != INDEX_NONE && Policy.bEnableValidation && !IsValidForReuse(Objects[InactiveIndex]))
 	{
-		RebuildInactiveIndices();
+		UE_LOG(LogRavenPool, Warning, TEXT("Pooled object failed validation, removing it from the pool"));
+		DestroySlot(InactiveIndex);
+		InactiveIndex = FindInactiveObject(Location);
 	}
 
-	// Try to reuse an inactive object from the pool
-	const int32 InactiveIndex = FindInactiveObject();
-	if (InactiveIndex != INDEX_NONE)
+	// A full pool without inactive objects handles the acquisition according to its overflow policy
+	if (InactiveIndex == INDEX_NONE && !HasCapacity())
 	{
-		FRavenPoolEntry& Entry = Pool[InactiveIndex];
-
-		// Validate the object before reusing
-		if (Policy.bEnableValidation && !Entry.Validate())
+		if (Policy.OverflowPolicy == ERavenPoolOverflowPolicy::SpawnTransient && bAllowTransient)
 		{
-			UE_LOG(LogRavenPool, Warning, TEXT("Pooled object failed validation, removing and creating new one"));
-			Factory->DestroyPoolObject(Entry.Object);
-			Pool.RemoveAtSwap(InactiveIndex);
-			bInactiveIndicesDirty = true;
-			ObjectToIndex.Remove(Entry.Object);
-			MarkStatsDirty();
-			return Acquire(); // Recursive call to try again
+			UObject* Object = CreateTransientObject();
+			if (Object)
+			{
+				PrepareDormant(Object);
+				HookDispatch.OnAcquiredFromPool(Object);
+				HookDispatch.PrepareForUsage(Factory, Object);
+			}
+			return Object;
 		}
 
-		Entry.bIsActive = true;
-		Entry.LastUsedTime = FPlatformTime::Seconds();
-		Entry.AcquireCount++;
-
-		// Remove from inactive indices
-		InactiveIndices.Remove(InactiveIndex);
-
-		// Notify strategy
-		if (AcquisitionStrategy.IsValid())
+		if (Policy.OverflowPolicy == ERavenPoolOverflowPolicy::RecycleOldest)
+		{
+			InactiveIndex = RecycleOldestActive(FPlatformTime::Seconds());
+		}
+		else if (Policy.OverflowPolicy == ERavenPoolOverflowPolicy::SpawnTransient)
 		{
-			AcquisitionStrategy->OnObjectAcquired(InactiveIndex);
+			UE_LOG(LogRavenPool, Verbose, TEXT("Pool for class %s cannot spawn a transient object when a slot id is requested, transient objects have no slot"),
+				*ObjectClass->GetName());
 		}
 
-		// Call IPoolable interface
-		if (Entry.Object->Implements<UPoolable>())
+		if (InactiveIndex == INDEX_NONE)
 		{
-			IPoolable::Execute_OnAcquiredFromPool(Entry.Object);
+			ReportOverflowFailure();
+			return nullptr;
 		}
+	}
+
+	if (InactiveIndex != INDEX_NONE)
+	{
+		RAVEN_POOL_NO_ALLOCATION_SCOPE(Policy.bNoAllocation, "FRavenPool::Acquire");
+
+		UObject* Object = Objects[InactiveIndex];
+		ActivateSlot(InactiveIndex, FPlatformTime::Seconds());
 
-		Factory->PrepareForUsage(Entry.Object);
+		// The object is still in storage state here, so placing it doesn't update overlaps or render state twice
+		PrepareDormant(Object);
 
-		CachedStats.TotalAcquisitions++;
-		CachedStats.TotalReuses++;
-		MarkStatsDirty();
+		HookDispatch.OnAcquiredFromPool(Object);
+		HookDispatch.PrepareForUsage(Factory, Object);
+
+		OutSlotId = MakeSlotId(InactiveIndex);
 
 		UE_LOG(LogRavenPool, Verbose, TEXT("Reusing pooled object of class %s"), *ObjectClass->GetName());
-		return Entry.Object;
+		return Object;
 	}
 
-	// Check if we've reached the maximum pool size
-	if (MaxPoolSize > 0 && Pool.Num() >= MaxPoolSize)
+	if (Policy.bNoAllocation)
 	{
-		UE_LOG(LogRavenPool, Warning, TEXT("Cannot create new object: Pool for class %s has reached max size %d"),
-			*ObjectClass->GetName(), MaxPoolSize);
-		return nullptr;
+		UE_LOG(LogRavenPool, Warning, TEXT("Pool for class %s in no-allocation mode ran dry and has to create an object, consider raising its initial size"),
+			*ObjectClass->GetName());
 	}
 
 	// No inactive object found, create a new one
 	FPoolCreationContext Context;
 	Context.ObjectClass = ObjectClass;
-	Context.CurrentPoolSize = Pool.Num();
+	Context.CurrentPoolSize = NumObjects;
 	Context.bIsPreWarming = false;
 
 	UObject* Object = Factory->CreatePoolObject(ObjectClass);
@@ -119,33 +162,154 @@ UObject* FRavenPool::Acquire()
 		return nullptr;
 	}
 
-	// Call IPoolable interface
-	if (Object->Implements<UPoolable>())
+	PrepareDormant(Object);
+
+	HookDispatch.OnAcquiredFromPool(Object);
+	HookDispatch.PrepareForUsage(Factory, Object);
+
+	const int32 NewIndex = AllocateSlot(Object, true, FPlatformTime::Seconds());
+
+	OutSlotId = MakeSlotId(NewIndex);
+
+	UE_LOG(LogRavenPool, Log, TEXT("Created new pooled object of class %s (Pool size: %d)"), *ObjectClass->GetName(), NumObjects);
+	return Object;
+}
+
+int32 FRavenPool::AcquireMany(const int32 Count, TArray<UObject*>& OutObjects)
+{
+	return AcquireBatch(Count, nullptr, OutObjects);
+}
+
+int32 FRavenPool::AcquireManyAtTransforms(const TConstArrayView<FTransform> Transforms, TArray<UObject*>& OutObjects)
+{
+	return AcquireBatch(Transforms.Num(), Transforms.GetData(), OutObjects);
+}
+
+int32 FRavenPool::AcquireBatch(const int32 Count, const FTransform* Transforms, TArray<UObject*>& OutObjects)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_AcquireMany);
+
+	if (!IsValid(Factory) || !IsValid(ObjectClass))
+	{
+		UE_LOG(LogRavenPool, Error, TEXT("Cannot acquire objects: Factory or ObjectClass is invalid"));
+		return 0;
+	}
+
+	if (Count <= 0)
 	{
-		IPoolable::Execute_OnAcquiredFromPool(Object);
+		return 0;
 	}
 
-	Factory->PrepareForUsage(Object);
+	OutObjects.Reserve(OutObjects.Num() + Count);
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	int32 NumReused = 0;
+	int32 NumCreated = 0;
+	int32 NumTransient = 0;
+	int32 NumDiscarded = 0;
 
-	const int32 NewIndex = Pool.Num();
-	FRavenPoolEntry& NewEntry = Pool.Emplace_GetRef(FRavenPoolEntry{
-		.bIsActive = true,
-		.Object = Object,
-		.LastUsedTime = FPlatformTime::Seconds(),
-		.AcquireCount = 1
-	});
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector Location = Transforms ? Transforms[i].GetLocation() : FVector::ZeroVector;
+		const FVector* DesiredLocation = Transforms ? &Location : nullptr;
 
-	// Add to object index map
-	ObjectToIndex.Add(Object, NewIndex);
+		// Try to reuse an inactive object from the pool, discarding any that fail validation
+		int32 Index = FindInactiveObject(DesiredLocation);
+		while (Index != INDEX_NONE && Policy.bEnableValidation && !IsValidForReuse(Objects[Index]))
+		{
+			DestroySlot(Index);
+			++NumDiscarded;
+			Index = FindInactiveObject(DesiredLocation);
+		}
 
-	// Update stats
-	CachedStats.TotalCreated++;
-	CachedStats.TotalAcquisitions++;
-	CachedStats.PeakPoolSize = FMath::Max(CachedStats.PeakPoolSize, Pool.Num());
-	MarkStatsDirty();
+		// Never recycle an object handed out earlier in this batch
+		if (Index == INDEX_NONE && !HasCapacity() && Policy.OverflowPolicy == ERavenPoolOverflowPolicy::RecycleOldest
+			&& OldestActive != INDEX_NONE && LastUsedTimes[OldestActive] < CurrentTime)
+		{
+			Index = RecycleOldestActive(CurrentTime);
+		}
 
-	UE_LOG(LogRavenPool, Log, TEXT("Created new pooled object of class %s (Pool size: %d)"), *ObjectClass->GetName(), Pool.Num());
-	return Object;
+		UObject* Object = nullptr;
+		const bool bReused = Index != INDEX_NONE;
+		if (bReused)
+		{
+			Object = Objects[Index];
+			ActivateSlot(Index, CurrentTime);
+			++NumReused;
+		}
+		else if (!HasCapacity())
+		{
+			Object = Policy.OverflowPolicy == ERavenPoolOverflowPolicy::SpawnTransient ? CreateTransientObject() : nullptr;
+			if (!Object)
+			{
+				ReportOverflowFailure();
+				UE_LOG(LogRavenPool, Verbose, TEXT("Pool for class %s reached max size %d, acquired %d of %d objects"),
+					*ObjectClass->GetName(), MaxPoolSize, i, Count);
+				break;
+			}
+			++NumTransient;
+		}
+		else
+		{
+			Object = Factory->CreatePoolObject(ObjectClass);
+			if (!IsValid(Object))
+			{
+				UE_LOG(LogRavenPool, Error, TEXT("Failed to create new pooled object of class %s, acquired %d of %d objects"),
+					*ObjectClass->GetName(), i, Count);
+				break;
+			}
+
+			AllocateSlot(Object, true, CurrentTime);
+			++NumCreated;
+		}
+
+		if (Transforms)
+		{
+			ApplyTransform(Object, Transforms[i]);
+		}
+
+		{
+			RAVEN_POOL_NO_ALLOCATION_SCOPE(Policy.bNoAllocation && bReused, "FRavenPool::AcquireMany");
+
+			HookDispatch.OnAcquiredFromPool(Object);
+			HookDispatch.PrepareForUsage(Factory, Object);
+		}
+
+		OutObjects.Add(Object);
+	}
+
+	if (NumDiscarded > 0)
+	{
+		UE_LOG(LogRavenPool, Warning, TEXT("%d pooled objects of class %s failed validation and were removed from the pool"),
+			NumDiscarded, *ObjectClass->GetName());
+	}
+
+	if (NumCreated > 0)
+	{
+		if (Policy.bNoAllocation)
+		{
+			UE_LOG(LogRavenPool, Warning, TEXT("Pool for class %s in no-allocation mode ran dry and had to create %d objects, consider raising its initial size"),
+				*ObjectClass->GetName(), NumCreated);
+		}
+
+		UE_LOG(LogRavenPool, Log, TEXT("Created %d new pooled objects of class %s (Pool size: %d)"), NumCreated, *ObjectClass->GetName(), NumObjects);
+	}
+
+	UE_LOG(LogRavenPool, Verbose, TEXT("Acquired %d objects of class %s (%d reused, %d transient)"),
+		NumReused + NumCreated + NumTransient, *ObjectClass->GetName(), NumReused, NumTransient);
+	return NumReused + NumCreated + NumTransient;
+}
+
+void FRavenPool::ApplyTransform(UObject* Object, const FTransform& Transform)
+{
+	if (AActor* Actor = Cast<AActor>(Object))
+	{
+		Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+	else if (USceneComponent* Component = Cast<USceneComponent>(Object))
+	{
+		Component->SetWorldTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+	}
 }
 
 bool FRavenPool::Release(UObject* Object)
@@ -159,411 +323,1451 @@ bool FRavenPool::Release(UObject* Object)
 	}
 
 	// Fast lookup using index map
-	int32* IndexPtr = ObjectToIndex.Find(Object);
-	if (!IndexPtr || !Pool.IsValidIndex(*IndexPtr))
+	const int32* IndexPtr = ObjectToIndex.Find(Object);
+	if (!IndexPtr || !Objects.IsValidIndex(*IndexPtr) || Objects[*IndexPtr] != Object)
 	{
+		if (!TransientObjects.IsEmpty() && ReleaseTransient(Object))
+		{
+			return true;
+		}
+
 		UE_LOG(LogRavenPool, Warning, TEXT("Attempted to release object that doesn't belong to this pool"));
 		return false;
 	}
 
-	FRavenPoolEntry& Entry = Pool[*IndexPtr];
-
-	if (!Entry.bIsActive)
+	if (!ReleaseSlot(*IndexPtr, FPlatformTime::Seconds()))
 	{
-		UE_LOG(LogRavenPool, Warning, TEXT("Attempted to release already inactive object of class %s"), *ObjectClass->GetName());
 		return false;
 	}
 
-	Entry.bIsActive = false;
-	Entry.LastUsedTime = FPlatformTime::Seconds();
+	UE_LOG(LogRavenPool, Verbose, TEXT("Released object of class %s back to pool"), *ObjectClass->GetName());
+	return true;
+}
 
-	// Mark indices as dirty so they'll be rebuilt on next acquire
-	bInactiveIndicesDirty = true;
+bool FRavenPool::Release(const FRavenPoolSlotId& SlotId)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_Release);
 
-	// Notify strategy
-	if (AcquisitionStrategy.IsValid())
+	if (!IsValid(Factory))
 	{
-		AcquisitionStrategy->OnObjectReleased(*IndexPtr);
+		UE_LOG(LogRavenPool, Warning, TEXT("Cannot release object: Factory is invalid"));
+		return false;
 	}
 
-	// Call IPoolable interface
-	if (Entry.Object->Implements<UPoolable>())
+	if (!IsValidSlotId(SlotId))
 	{
-		IPoolable::Execute_OnReturnedToPool(Entry.Object);
+		UE_LOG(LogRavenPool, Verbose, TEXT("Ignoring release of stale slot %d (generation %u) in pool for class %s"),
+			SlotId.Slot, SlotId.Generation, ObjectClass ? *ObjectClass->GetName() : TEXT("Unknown"));
+		return false;
 	}
 
-	Factory->PrepareForStorage(Entry.Object);
-
-	CachedStats.TotalReleases++;
-	MarkStatsDirty();
+	if (!ReleaseSlot(SlotId.Slot, FPlatformTime::Seconds()))
+	{
+		return false;
+	}
 
 	UE_LOG(LogRavenPool, Verbose, TEXT("Released object of class %s back to pool"), *ObjectClass->GetName());
 	return true;
 }
 
-void FRavenPool::PreWarm(int32 Count)
+FRavenPoolReservationTicket FRavenPool::ReserveBurst(const int32 Count, const float Timeout)
 {
-	SCOPE_CYCLE_COUNTER(STAT_Pool_PreWarm);
+	FRavenPoolReservationTicket Ticket;
 
 	if (!IsValid(Factory) || !IsValid(ObjectClass))
 	{
-		UE_LOG(LogRavenPool, Error, TEXT("Cannot pre-warm pool: Factory or ObjectClass is invalid"));
-		return;
+		UE_LOG(LogRavenPool, Error, TEXT("Cannot reserve objects: Factory or ObjectClass is invalid"));
+		return Ticket;
 	}
 
 	if (Count <= 0)
 	{
-		return;
+		return Ticket;
 	}
 
-	// Calculate how many objects we can actually create based on max pool size
-	int32 ObjectsToCreate = Count;
-	if (MaxPoolSize > 0)
+	FRavenPoolReservation NewReservation;
+	NewReservation.Slots.Reserve(Count);
+	NewReservation.NumPending = Count;
+	NewReservation.ExpiryTime = FPlatformTime::Seconds() + FMath::Max(Timeout, 0.0f);
+	NewReservation.Serial = NextReservationSerial++;
+	const int32 ReservationIndex = Reservations.Add(MoveTemp(NewReservation));
+
+	// Set aside what is already free, the rest is created over the next frames
+	FRavenPoolReservation& Reservation = Reservations[ReservationIndex];
+	while (Reservation.NumPending > 0 && !FreeList.IsEmpty())
 	{
-		const int32 AvailableSlots = MaxPoolSize - Pool.Num();
-		ObjectsToCreate = FMath::Min(Count, AvailableSlots);
-		if (ObjectsToCreate < Count)
-		{
-			UE_LOG(LogRavenPool, Warning, TEXT("Pre-warming limited to %d objects (max pool size: %d)"),
-				ObjectsToCreate, MaxPoolSize);
-		}
+		ReserveSlot(FreeList.GetOldest(), ReservationIndex);
+		Reservation.NumPending--;
 	}
 
-	UE_LOG(LogRavenPool, Log, TEXT("Pre-warming pool for class %s with %d objects"),
-		*ObjectClass->GetName(), ObjectsToCreate);
-
-	FPoolCreationContext Context;
-	Context.ObjectClass = ObjectClass;
-	Context.bIsPreWarming = true;
-
-	for (int32 i = 0; i < ObjectsToCreate; ++i)
+	if (Reservation.NumPending > 0)
 	{
-		Context.CurrentPoolSize = Pool.Num();
-
-		UObject* Object = Factory->CreatePoolObject(ObjectClass);
-		if (IsValid(Object))
-		{
-			Factory->PrepareForStorage(Object);
-
-			const int32 NewIndex = Pool.Num();
-			Pool.Emplace(FRavenPoolEntry{
-				.bIsActive = false,
-				.Object = Object,
-				.LastUsedTime = FPlatformTime::Seconds(),
-				.AcquireCount = 0
-			});
+		NumPendingReservations++;
 
-			ObjectToIndex.Add(Object, NewIndex);
-			CachedStats.TotalCreated++;
-		}
-		else
-		{
-			UE_LOG(LogRavenPool, Error, TEXT("Failed to create object %d/%d during pre-warming"),
-				i + 1, ObjectsToCreate);
-		}
+		// Grow the bookkeeping now rather than while filling
+		const int32 TargetSize = NumObjects + Reservation.NumPending;
+		Reserve(MaxPoolSize > 0 ? FMath::Min(TargetSize, MaxPoolSize) : TargetSize);
 	}
 
-	bInactiveIndicesDirty = true;
-	CachedStats.PeakPoolSize = FMath::Max(CachedStats.PeakPoolSize, Pool.Num());
-	MarkStatsDirty();
+	UE_LOG(LogRavenPool, Log, TEXT("Reserved %d objects of class %s for %.1fs (%d to be created)"),
+		Count, *ObjectClass->GetName(), Timeout, Reservation.NumPending);
 
-	UE_LOG(LogRavenPool, Log, TEXT("Pre-warmed pool for class %s (Pool size: %d)"),
-		*ObjectClass->GetName(), Pool.Num());
+	Ticket.PoolId = PoolId;
+	Ticket.Reservation = ReservationIndex;
+	Ticket.Serial = Reservation.Serial;
+	return Ticket;
 }
 
-void FRavenPool::PreWarmAsync(int32 Count, TFunction<void()> Callback)
+UObject* FRavenPool::AcquireReserved(const FRavenPoolReservationTicket& Ticket, FRavenPoolSlotId& OutSlotId)
 {
-	// TODO: Implement async pre-warming
-	// For now, just call synchronous version
-	PreWarm(Count);
-	if (Callback)
-	{
-		Callback();
-	}
-}
+	SCOPE_CYCLE_COUNTER(STAT_Pool_Acquire);
 
-void FRavenPool::ClearInactive()
-{
-	SCOPE_CYCLE_COUNTER(STAT_Pool_ClearInactive);
+	OutSlotId = FRavenPoolSlotId();
 
-	if (!IsValid(Factory))
+	FRavenPoolReservation* Reservation = FindReservation(Ticket);
+	if (!Reservation || !IsValid(Factory))
 	{
-		UE_LOG(LogRavenPool, Warning, TEXT("Cannot clear inactive objects: Factory is invalid"));
-		return;
+		return nullptr;
 	}
 
-	const int32 InitialSize = Pool.Num();
-
-	// Destroy all inactive objects
-	for (int32 i = Pool.Num() - 1; i >= 0; --i)
+	const double CurrentTime = FPlatformTime::Seconds();
+	while (Reservation && Reservation->Slots.Num() > 0)
 	{
-		if (!Pool[i].bIsActive && IsValid(Pool[i].Object))
+		const int32 Index = Reservation->Slots.Last();
+		if (Policy.bEnableValidation && !IsValidForReuse(Objects[Index]))
 		{
-			// Call IPoolable interface before destroying
-			if (Pool[i].Object->Implements<UPoolable>())
-			{
-				IPoolable::Execute_OnPoolDestroy(Pool[i].Object);
-			}
+			// Destroying a reserved entry puts it back on the reservation's pending count. Its hooks may
+			// reserve or cancel, so the reservation is looked up again.
+			UE_LOG(LogRavenPool, Warning, TEXT("Reserved object failed validation, removing it from the pool"));
+			DestroySlot(Index);
+			Reservation = FindReservation(Ticket);
+			continue;
+		}
+
+		RAVEN_POOL_NO_ALLOCATION_SCOPE(Policy.bNoAllocation, "FRavenPool::AcquireReserved");
 
-			Factory->DestroyPoolObject(Pool[i].Object);
-			ObjectToIndex.Remove(Pool[i].Object);
-			Pool.RemoveAtSwap(i);
+		UObject* Object = Objects[Index];
+		ActivateSlot(Index, CurrentTime);
+
+		// A fully used reservation is freed right away, before the hooks can reserve or cancel and
+		// invalidate it
+		if (Reservation->Slots.IsEmpty() && Reservation->NumPending == 0)
+		{
+			FreeReservation(Ticket.Reservation, CurrentTime);
 		}
-	}
 
-	// Rebuild object index map after swap removes
-	ObjectToIndex.Empty();
-	for (int32 i = 0; i < Pool.Num(); ++i)
-	{
-		ObjectToIndex.Add(Pool[i].Object, i);
+		HookDispatch.OnAcquiredFromPool(Object);
+		HookDispatch.PrepareForUsage(Factory, Object);
+
+		OutSlotId = MakeSlotId(Index);
+		return Object;
 	}
 
-	bInactiveIndicesDirty = true;
-	MarkStatsDirty();
+	return nullptr;
+}
 
-	const int32 RemovedCount = InitialSize - Pool.Num();
-	if (RemovedCount > 0)
+void FRavenPool::CancelReservation(const FRavenPoolReservationTicket& Ticket)
+{
+	if (FindReservation(Ticket))
 	{
-		UE_LOG(LogRavenPool, Log, TEXT("Cleared %d inactive objects from pool (Pool size: %d -> %d)"),
-			RemovedCount, InitialSize, Pool.Num());
+		FreeReservation(Ticket.Reservation, FPlatformTime::Seconds());
 	}
 }
 
-void FRavenPool::Tick(float DeltaTime)
+int32 FRavenPool::GetReservedCount(const FRavenPoolReservationTicket& Ticket) const
 {
-	SCOPE_CYCLE_COUNTER(STAT_Pool_Tick);
+	const FRavenPoolReservation* Reservation = FindReservation(Ticket);
+	return Reservation ? Reservation->Slots.Num() : 0;
+}
 
-	// Handle periodic shrinking
-	if (Policy.ShrinkInterval > 0.0f)
+void FRavenPool::FillReservations(const double Deadline)
+{
+	if (!IsValid(Factory) || !IsValid(ObjectClass))
 	{
-		TimeSinceLastShrink += DeltaTime;
-		if (TimeSinceLastShrink >= Policy.ShrinkInterval)
-		{
-			TimeSinceLastShrink = 0.0f;
+		return;
+	}
 
-			// Remove inactive objects down to minimum pool size
-			const int32 InactiveCount = GetInactiveCount();
-			const int32 TargetInactiveCount = FMath::Max(0, Policy.MinPoolSize - GetActiveCount());
-			const int32 ToRemove = InactiveCount - TargetInactiveCount;
+	const double CurrentTime = FPlatformTime::Seconds();
+	bool bCreatedAny = false;
 
-			if (ToRemove > 0)
-			{
-				UE_LOG(LogRavenPool, Log, TEXT("Shrinking pool for class %s: removing %d inactive objects"),
-					*ObjectClass->GetName(), ToRemove);
+	for (int32 ReservationIndex = 0; ReservationIndex < Reservations.GetMaxIndex() && NumPendingReservations > 0; ++ReservationIndex)
+	{
+		if (!Reservations.IsAllocated(ReservationIndex))
+		{
+			continue;
+		}
 
-				int32 Removed = 0;
-				for (int32 i = Pool.Num() - 1; i >= 0 && Removed < ToRemove; --i)
+		while (Reservations[ReservationIndex].NumPending > 0)
+		{
+			// Objects released since the reservation was made are taken before creating new ones
+			int32 Index = FreeList.IsEmpty() ? INDEX_NONE : FreeList.GetOldest();
+			if (Index == INDEX_NONE)
+			{
+				if (!HasCapacity() || (bCreatedAny && FPlatformTime::Seconds() >= Deadline))
 				{
-					if (!Pool[i].bIsActive && IsValid(Pool[i].Object))
-					{
-						// Call IPoolable interface
-						if (Pool[i].Object->Implements<UPoolable>())
-						{
-							IPoolable::Execute_OnPoolDestroy(Pool[i].Object);
-						}
-
-						Factory->DestroyPoolObject(Pool[i].Object);
-						ObjectToIndex.Remove(Pool[i].Object);
-						Pool.RemoveAtSwap(i);
-						Removed++;
-					}
+					return;
 				}
 
-				// Rebuild object index after removals
-				ObjectToIndex.Empty();
-				for (int32 i = 0; i < Pool.Num(); ++i)
+				UObject* Object = Factory->CreatePoolObject(ObjectClass);
+				if (!IsValid(Object))
 				{
-					ObjectToIndex.Add(Pool[i].Object, i);
+					UE_LOG(LogRavenPool, Error, TEXT("Failed to create object of class %s for a reservation"), *ObjectClass->GetName());
+					return;
 				}
 
-				bInactiveIndicesDirty = true;
-				MarkStatsDirty();
-			}
-		}
-	}
-
-	// Handle max idle time
-	if (Policy.MaxIdleTime > 0.0f)
-	{
-		const double CurrentTime = FPlatformTime::Seconds();
-		int32 Removed = 0;
-
-		for (int32 i = Pool.Num() - 1; i >= 0; --i)
-		{
-			if (!Pool[i].bIsActive && IsValid(Pool[i].Object))
-			{
-				const double IdleTime = CurrentTime - Pool[i].LastUsedTime;
-				if (IdleTime >= Policy.MaxIdleTime)
-				{
-					// Don't go below minimum pool size
-					if (Pool.Num() - Removed > Policy.MinPoolSize)
-					{
-						// Call IPoolable interface
-						if (Pool[i].Object->Implements<UPoolable>())
-						{
-							IPoolable::Execute_OnPoolDestroy(Pool[i].Object);
-						}
-
-						Factory->DestroyPoolObject(Pool[i].Object);
-						ObjectToIndex.Remove(Pool[i].Object);
-						Pool.RemoveAtSwap(i);
-						Removed++;
-					}
-				}
+				HookDispatch.PrepareForStorage(Factory, Object);
+				Index = AllocateSlot(Object, false, CurrentTime);
+				bCreatedAny = true;
 			}
-		}
 
-		if (Removed > 0)
-		{
-			// Rebuild object index after removals
-			ObjectToIndex.Empty();
-			for (int32 i = 0; i < Pool.Num(); ++i)
+			ReserveSlot(Index, ReservationIndex);
+			if (--Reservations[ReservationIndex].NumPending == 0)
 			{
-				ObjectToIndex.Add(Pool[i].Object, i);
+				NumPendingReservations--;
 			}
-
-			bInactiveIndicesDirty = true;
-			MarkStatsDirty();
-
-			UE_LOG(LogRavenPool, Log, TEXT("Removed %d idle objects from pool for class %s"),
-				Removed, *ObjectClass->GetName());
 		}
 	}
 }
 
-int32 FRavenPool::ValidatePool()
+int32 FRavenPool::ReleaseMany(const TConstArrayView<FRavenPoolSlotId> SlotIds)
 {
-	SCOPE_CYCLE_COUNTER(STAT_Pool_Validate);
+	SCOPE_CYCLE_COUNTER(STAT_Pool_ReleaseMany);
 
-	if (!Policy.bEnableValidation)
+	if (!IsValid(Factory))
 	{
+		UE_LOG(LogRavenPool, Warning, TEXT("Cannot release objects: Factory is invalid"));
 		return 0;
 	}
 
-	int32 RemovedCount = 0;
+	const double CurrentTime = FPlatformTime::Seconds();
+	int32 NumReleased = 0;
 
-	for (int32 i = Pool.Num() - 1; i >= 0; --i)
+	for (const FRavenPoolSlotId& SlotId : SlotIds)
 	{
-		if (!Pool[i].Validate())
+		if (IsValidSlotId(SlotId) && ReleaseSlot(SlotId.Slot, CurrentTime))
 		{
-			UE_LOG(LogRavenPool, Warning, TEXT("Removing invalid object from pool"));
-
-			if (IsValid(Pool[i].Object))
-			{
-				// Call IPoolable interface
-				if (Pool[i].Object->Implements<UPoolable>())
-				{
-					IPoolable::Execute_OnPoolDestroy(Pool[i].Object);
-				}
-
-				Factory->DestroyPoolObject(Pool[i].Object);
-			}
-
-			ObjectToIndex.Remove(Pool[i].Object);
-			Pool.RemoveAtSwap(i);
-			RemovedCount++;
+			++NumReleased;
 		}
 	}
 
-	if (RemovedCount > 0)
-	{
-		// Rebuild object index
-		ObjectToIndex.Empty();
-		for (int32 i = 0; i < Pool.Num(); ++i)
-		{
-			ObjectToIndex.Add(Pool[i].Object, i);
-		}
+	UE_LOG(LogRavenPool, Verbose, TEXT("Released %d of %d slots back to the pool for class %s"), NumReleased, SlotIds.Num(), ObjectClass ? *ObjectClass->GetName() : TEXT("Unknown"));
+	return NumReleased;
+}
 
-		bInactiveIndicesDirty = true;
-		MarkStatsDirty();
+UObject* FRavenPool::AcquireForOwner(const UObject* Owner, FRavenPoolSlotId& OutSlotId)
+{
+	UObject* Object = AcquireInternal(nullptr, [](UObject*) {}, OutSlotId, false);
+	if (Object && Owner)
+	{
+		LinkOwner(OutSlotId.Slot, Owner);
 	}
-
-	return RemovedCount;
+	return Object;
 }
 
-int32 FRavenPool::GetActiveCount() const
+int32 FRavenPool::ReleaseAllForOwner(const UObject* Owner)
 {
-	if (bStatsDirty)
-	{
-		// Recalculate cached stats
-		FRavenPool* MutableThis = const_cast<FRavenPool*>(this);
-		MutableThis->CachedStats.ActiveCount = 0;
-		MutableThis->CachedStats.InactiveCount = 0;
+	SCOPE_CYCLE_COUNTER(STAT_Pool_ReleaseMany);
 
-		for (const FRavenPoolEntry& Entry : Pool)
+	const int32* ListIndex = OwnerListsByKey.Find(FObjectKey(Owner));
+	if (!ListIndex)
+	{
+		return 0;
+	}
+
+	const int32 NumReleased = ReleaseOwnerList(*ListIndex, FPlatformTime::Seconds());
+
+	UE_LOG(LogRavenPool, Verbose, TEXT("Released %d objects of class %s for owner %s"), NumReleased, *ObjectClass->GetName(), *GetNameSafe(Owner));
+	return NumReleased;
+}
+
+int32 FRavenPool::GetOwnedCount(const UObject* Owner) const
+{
+	const int32* ListIndex = OwnerListsByKey.Find(FObjectKey(Owner));
+	return ListIndex ? OwnerLists[*ListIndex].Num : 0;
+}
+
+int32 FRavenPool::ReleaseMany(const TConstArrayView<UObject*> InObjects)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_ReleaseMany);
+
+	if (!IsValid(Factory))
+	{
+		UE_LOG(LogRavenPool, Warning, TEXT("Cannot release objects: Factory is invalid"));
+		return 0;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	int32 NumReleased = 0;
+
+	for (UObject* Object : InObjects)
+	{
+		// Same identity check as Release, a stale key must not release whatever object now occupies the slot
+		const int32* IndexPtr = Object ? ObjectToIndex.Find(Object) : nullptr;
+		if (!IndexPtr || !Objects.IsValidIndex(*IndexPtr) || Objects[*IndexPtr] != Object)
 		{
-			if (Entry.bIsActive)
-			{
-				MutableThis->CachedStats.ActiveCount++;
-			}
-			else
+			if (Object && !TransientObjects.IsEmpty() && ReleaseTransient(Object))
 			{
-				MutableThis->CachedStats.InactiveCount++;
+				++NumReleased;
+				continue;
 			}
+
+			UE_LOG(LogRavenPool, Warning, TEXT("Attempted to release object that doesn't belong to this pool"));
+			continue;
+		}
+
+		if (ReleaseSlot(*IndexPtr, CurrentTime))
+		{
+			++NumReleased;
 		}
+	}
+
+	UE_LOG(LogRavenPool, Verbose, TEXT("Released %d objects back to the pool for class %s"), NumReleased, ObjectClass ? *ObjectClass->GetName() : TEXT("Unknown"));
+	return NumReleased;
+}
 
-		MutableThis->CachedStats.TotalCount = Pool.Num();
-		MutableThis->CachedStats.CalculateUsagePercent();
-		MutableThis->bStatsDirty = false;
+bool FRavenPool::IsValidSlotId(const FRavenPoolSlotId& SlotId) const
+{
+	if (SlotId.PoolId != PoolId || !Pool.IsValidIndex(SlotId.Slot))
+	{
+		return false;
 	}
 
-	return CachedStats.ActiveCount;
+	return ActiveSlots[SlotId.Slot] && Pool[SlotId.Slot].Generation == SlotId.Generation;
+}
+
+UObject* FRavenPool::ResolveSlotId(const FRavenPoolSlotId& SlotId) const
+{
+	return IsValidSlotId(SlotId) ? Objects[SlotId.Slot].Get() : nullptr;
 }
 
-int32 FRavenPool::GetInactiveCount() const
+void FRavenPool::PreWarm(int32 Count)
 {
-	if (bStatsDirty)
+	SCOPE_CYCLE_COUNTER(STAT_Pool_PreWarm);
+
+	if (!IsValid(Factory) || !IsValid(ObjectClass))
+	{
+		UE_LOG(LogRavenPool, Error, TEXT("Cannot pre-warm pool: Factory or ObjectClass is invalid"));
+		return;
+	}
+
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	// Calculate how many objects we can actually create based on max pool size
+	int32 ObjectsToCreate = Count;
+	if (MaxPoolSize > 0)
+	{
+		const int32 AvailableSlots = MaxPoolSize - NumObjects;
+		ObjectsToCreate = FMath::Min(Count, AvailableSlots);
+		if (ObjectsToCreate < Count)
+		{
+			UE_LOG(LogRavenPool, Warning, TEXT("Pre-warming limited to %d objects (max pool size: %d)"),
+				ObjectsToCreate, MaxPoolSize);
+		}
+	}
+
+	UE_LOG(LogRavenPool, Log, TEXT("Pre-warming pool for class %s with %d objects"),
+		*ObjectClass->GetName(), ObjectsToCreate);
+
+	// Reserve all bookkeeping up front; in no-allocation mode for the largest size the pool may grow to
+	Reserve(Policy.bNoAllocation && MaxPoolSize > 0 ? MaxPoolSize : NumObjects + ObjectsToCreate);
+
+	FPoolCreationContext Context;
+	Context.ObjectClass = ObjectClass;
+	Context.bIsPreWarming = true;
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < ObjectsToCreate; ++i)
 	{
-		GetActiveCount(); // This will recalculate all stats
+		Context.CurrentPoolSize = NumObjects;
+
+		UObject* Object = Factory->CreatePoolObject(ObjectClass);
+		if (IsValid(Object))
+		{
+			HookDispatch.PrepareForStorage(Factory, Object);
+			AllocateSlot(Object, false, CurrentTime);
+		}
+		else
+		{
+			UE_LOG(LogRavenPool, Error, TEXT("Failed to create object %d/%d during pre-warming"),
+				i + 1, ObjectsToCreate);
+		}
 	}
-	return CachedStats.InactiveCount;
+
+	UE_LOG(LogRavenPool, Log, TEXT("Pre-warmed pool for class %s (Pool size: %d)"),
+		*ObjectClass->GetName(), NumObjects);
 }
 
-FRavenPoolStats FRavenPool::GetStats() const
+int32 FRavenPool::PreWarmAsync(const int32 Count, TFunction<void()> Callback)
 {
-	if (bStatsDirty)
+	if (!IsValid(Factory) || !IsValid(ObjectClass))
+	{
+		UE_LOG(LogRavenPool, Error, TEXT("Cannot pre-warm pool: Factory or ObjectClass is invalid"));
+		if (Callback)
+		{
+			Callback();
+		}
+		return 0;
+	}
+
+	// Objects already queued count against the max pool size as well
+	int32 ObjectsToCreate = FMath::Max(Count, 0);
+	if (MaxPoolSize > 0)
+	{
+		ObjectsToCreate = FMath::Clamp(MaxPoolSize - NumObjects - PreWarmRemaining, 0, ObjectsToCreate);
+		if (ObjectsToCreate < Count)
+		{
+			UE_LOG(LogRavenPool, Warning, TEXT("Pre-warming limited to %d objects (max pool size: %d)"),
+				ObjectsToCreate, MaxPoolSize);
+		}
+	}
+
+	if (Callback)
+	{
+		PreWarmCallbacks.Add(MoveTemp(Callback));
+	}
+
+	if (ObjectsToCreate > 0)
+	{
+		PreWarmRemaining += ObjectsToCreate;
+		Reserve(Policy.bNoAllocation && MaxPoolSize > 0 ? MaxPoolSize : NumObjects + PreWarmRemaining);
+
+		UE_LOG(LogRavenPool, Log, TEXT("Queued pre-warming of pool for class %s with %d objects"),
+			*ObjectClass->GetName(), ObjectsToCreate);
+	}
+	else if (PreWarmRemaining == BackgroundPreWarmRemaining)
 	{
-		GetActiveCount(); // This will recalculate all stats
+		// Nothing to wait for
+		TArray<TFunction<void()>> Callbacks = MoveTemp(PreWarmCallbacks);
+		for (const TFunction<void()>& PendingCallback : Callbacks)
+		{
+			PendingCallback();
+		}
 	}
-	return CachedStats;
+
+	return ObjectsToCreate;
 }
 
-void FRavenPool::SetPolicy(const FRavenPoolPolicy& InPolicy)
+int32 FRavenPool::Replenish()
 {
-	Policy = InPolicy;
+	if (!IsValid(Factory) || !IsValid(ObjectClass))
+	{
+		return 0;
+	}
 
-	// Recreate acquisition strategy if it changed
-	if (!AcquisitionStrategy.IsValid() || Policy.AcquisitionStrategy != Policy.AcquisitionStrategy)
+	const int32 TargetFreeCount = FMath::Max(Policy.HighWatermark, Policy.LowWatermark);
+	int32 ObjectsToCreate = TargetFreeCount - FreeList.Num() - PreWarmRemaining;
+	if (MaxPoolSize > 0)
 	{
-		AcquisitionStrategy = FRavenPoolStrategyFactory::CreateStrategy(Policy.AcquisitionStrategy);
+		ObjectsToCreate = FMath::Min(ObjectsToCreate, MaxPoolSize - NumObjects - PreWarmRemaining);
+	}
+
+	if (ObjectsToCreate <= 0)
+	{
+		return 0;
 	}
+
+	QueueBackgroundPreWarm(ObjectsToCreate);
+
+	UE_LOG(LogRavenPool, Verbose, TEXT("Pool for class %s dropped below %d free objects, replenishing %d objects"),
+		*ObjectClass->GetName(), Policy.LowWatermark, ObjectsToCreate);
+	return ObjectsToCreate;
 }
 
-int32 FRavenPool::FindInactiveObject()
+bool FRavenPool::CreateInactiveObject()
 {
-	SCOPE_CYCLE_COUNTER(STAT_Pool_FindInactive);
+	if (!IsValid(Factory) || !IsValid(ObjectClass) || !HasCapacity())
+	{
+		return false;
+	}
 
-	if (!AcquisitionStrategy.IsValid())
+	UObject* Object = Factory->CreatePoolObject(ObjectClass);
+	if (!IsValid(Object))
+	{
+		UE_LOG(LogRavenPool, Error, TEXT("Failed to create inactive object of class %s"), *ObjectClass->GetName());
+		return false;
+	}
+
+	HookDispatch.PrepareForStorage(Factory, Object);
+	AllocateSlot(Object, false, FPlatformTime::Seconds());
+	return true;
+}
+
+void FRavenPool::QueueBackgroundPreWarm(const int32 Count)
+{
+	PreWarmRemaining += Count;
+	BackgroundPreWarmRemaining += Count;
+	Reserve(Policy.bNoAllocation && MaxPoolSize > 0 ? MaxPoolSize : NumObjects + PreWarmRemaining);
+}
+
+int32 FRavenPool::TickPreWarm(const double Deadline)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_PreWarm);
+
+	if (PreWarmRemaining <= 0)
+	{
+		return 0;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	int32 NumProcessed = 0;
+	int32 NumAttempted = 0;
+
+	while (PreWarmRemaining > 0 && (NumAttempted == 0 || FPlatformTime::Seconds() < Deadline))
+	{
+		// Acquisitions may have filled the pool since the objects were queued
+		if (!IsValid(Factory) || !HasCapacity())
+		{
+			NumProcessed += PreWarmRemaining - BackgroundPreWarmRemaining;
+			PreWarmRemaining = 0;
+			BackgroundPreWarmRemaining = 0;
+			break;
+		}
+
+		// Objects queued by PreWarmAsync go first, background ones don't count towards the result
+		if (PreWarmRemaining > BackgroundPreWarmRemaining)
+		{
+			NumProcessed++;
+		}
+		else
+		{
+			BackgroundPreWarmRemaining--;
+		}
+		PreWarmRemaining--;
+		NumAttempted++;
+
+		UObject* Object = Factory->CreatePoolObject(ObjectClass);
+		if (IsValid(Object))
+		{
+			HookDispatch.PrepareForStorage(Factory, Object);
+			AllocateSlot(Object, false, CurrentTime);
+		}
+		else
+		{
+			UE_LOG(LogRavenPool, Error, TEXT("Failed to create object of class %s during pre-warming"), *ObjectClass->GetName());
+		}
+	}
+
+	// Done once the objects queued by PreWarmAsync are, background objects may still follow
+	if (NumProcessed > 0 && PreWarmRemaining == BackgroundPreWarmRemaining)
+	{
+		UE_LOG(LogRavenPool, Log, TEXT("Pre-warmed pool for class %s (Pool size: %d)"),
+			*ObjectClass->GetName(), NumObjects);
+
+		// Callbacks may queue another pre-warm
+		TArray<TFunction<void()>> Callbacks = MoveTemp(PreWarmCallbacks);
+		for (const TFunction<void()>& Callback : Callbacks)
+		{
+			Callback();
+		}
+	}
+
+	return NumProcessed;
+}
+
+void FRavenPool::ClearInactive()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_ClearInactive);
+
+	if (!IsValid(Factory))
+	{
+		UE_LOG(LogRavenPool, Warning, TEXT("Cannot clear inactive objects: Factory is invalid"));
+		return;
+	}
+
+	const int32 InitialSize = NumObjects;
+
+	// Destroy all inactive objects by draining the free list
+	while (!FreeList.IsEmpty())
 	{
-		AcquisitionStrategy = FRavenPoolStrategyFactory::CreateStrategy(Policy.AcquisitionStrategy);
+		DestroySlot(FreeList.GetOldest());
 	}
 
-	return AcquisitionStrategy->FindInactiveObject(Pool, InactiveIndices);
+	const int32 RemovedCount = InitialSize - NumObjects;
+	if (RemovedCount > 0)
+	{
+		UE_LOG(LogRavenPool, Log, TEXT("Cleared %d inactive objects from pool (Pool size: %d -> %d)"),
+			RemovedCount, InitialSize, NumObjects);
+	}
 }
 
-void FRavenPool::RebuildInactiveIndices()
+void FRavenPool::Tick(const double CurrentTime)
 {
-	SCOPE_CYCLE_COUNTER(STAT_Pool_RebuildIndices);
+	SCOPE_CYCLE_COUNTER(STAT_Pool_Tick);
+
+	// Update the adaptive target first, shrinking and idle expiry keep the pool at it
+	if (Policy.bAdaptiveSizing && CurrentTime >= LastAdaptiveSampleTime + RavenPool::AdaptiveSampleInterval)
+	{
+		UpdateAdaptiveTarget(CurrentTime);
+	}
+
+	// Handle periodic shrinking
+	if (Policy.ShrinkInterval > 0.0f && CurrentTime >= NextShrinkTime)
+	{
+		// The first tick after enabling shrinking only schedules the first shrink
+		if (NextShrinkTime > 0.0)
+		{
+			// Remove inactive objects down to minimum pool size
+			const int32 InactiveCount = GetInactiveCount();
+			const int32 TargetInactiveCount = FMath::Max(0, GetRetainedPoolSize() - GetActiveCount());
+			const int32 ToRemove = InactiveCount - TargetInactiveCount;
+
+			if (ToRemove > 0)
+			{
+				UE_LOG(LogRavenPool, Log, TEXT("Shrinking pool for class %s: removing %d inactive objects"),
+					*ObjectClass->GetName(), ToRemove);
+
+				// Remove the objects that have been idle the longest first
+				for (int32 Removed = 0; Removed < ToRemove && !FreeList.IsEmpty(); ++Removed)
+				{
+					DestroySlot(FreeList.GetOldest());
+				}
+			}
+		}
+
+		NextShrinkTime = CurrentTime + Policy.ShrinkInterval;
+	}
+
+	// Handle max idle time. The free list is ordered by release time, so expired objects are always at its
+	// head and we only ever look at the objects that actually expire plus one.
+	if (Policy.MaxIdleTime > 0.0f)
+	{
+		const double ExpiryTime = CurrentTime - Policy.MaxIdleTime;
+		int32 Removed = 0;
 
-	InactiveIndices.Reset();
+		// Don't go below minimum pool size
+		while (NumObjects > GetRetainedPoolSize() && !FreeList.IsEmpty() && LastUsedTimes[FreeList.GetOldest()] <= ExpiryTime)
+		{
+			DestroySlot(FreeList.GetOldest());
+			Removed++;
+		}
+
+		if (Removed > 0)
+		{
+			UE_LOG(LogRavenPool, Log, TEXT("Removed %d idle objects from pool for class %s"),
+				Removed, *ObjectClass->GetName());
+		}
+	}
 
-	for (int32 i = 0; i < Pool.Num(); ++i)
+	// Return the unused objects of expired reservations to general use
+	for (int32 ReservationIndex = 0; ReservationIndex < Reservations.GetMaxIndex(); ++ReservationIndex)
 	{
-		if (!Pool[i].bIsActive)
+		if (Reservations.IsAllocated(ReservationIndex) && Reservations[ReservationIndex].ExpiryTime <= CurrentTime)
 		{
-			InactiveIndices.Add(i);
+			UE_LOG(LogRavenPool, Log, TEXT("Reservation of %d objects of class %s expired"),
+				Reservations[ReservationIndex].Slots.Num() + Reservations[ReservationIndex].NumPending, *ObjectClass->GetName());
+			FreeReservation(ReservationIndex, CurrentTime);
 		}
 	}
 
-	bInactiveIndicesDirty = false;
+	// Return the objects of owners that were garbage collected without releasing them
+	if (Policy.OwnerReclaimInterval > 0.0f && OwnerLists.Num() > 0 && CurrentTime >= NextOwnerReclaimTime)
+	{
+		ReclaimOrphanedObjects(CurrentTime);
+		NextOwnerReclaimTime = CurrentTime + Policy.OwnerReclaimInterval;
+	}
+
+	// Forget transient objects that were destroyed without being released
+	if (!TransientObjects.IsEmpty() && CurrentTime >= NextTransientPruneTime)
+	{
+		PruneTransientObjects();
+		NextTransientPruneTime = CurrentTime + RavenPool::TransientPruneInterval;
+	}
+}
+
+double FRavenPool::GetNextMaintenanceTime() const
+{
+	double NextTime = TNumericLimits<double>::Max();
+
+	if (Policy.ShrinkInterval > 0.0f)
+	{
+		NextTime = NextShrinkTime;
+	}
+
+	if (Policy.MaxIdleTime > 0.0f && NumObjects > GetRetainedPoolSize() && !FreeList.IsEmpty())
+	{
+		NextTime = FMath::Min(NextTime, LastUsedTimes[FreeList.GetOldest()] + Policy.MaxIdleTime);
+	}
+
+	if (Policy.OwnerReclaimInterval > 0.0f && OwnerLists.Num() > 0)
+	{
+		NextTime = FMath::Min(NextTime, NextOwnerReclaimTime);
+	}
+
+	if (Policy.bAdaptiveSizing)
+	{
+		NextTime = FMath::Min(NextTime, LastAdaptiveSampleTime + RavenPool::AdaptiveSampleInterval);
+	}
+
+	for (const FRavenPoolReservation& Reservation : Reservations)
+	{
+		NextTime = FMath::Min(NextTime, Reservation.ExpiryTime);
+	}
+
+	if (!TransientObjects.IsEmpty())
+	{
+		NextTime = FMath::Min(NextTime, NextTransientPruneTime);
+	}
+
+	return NextTime;
+}
+
+void FRavenPool::UpdateAdaptiveTarget(const double CurrentTime)
+{
+	const int64 TotalAcquisitions = Counters->GetTotalAcquisitions();
+	const int32 SamplePeak = FMath::Max(AdaptiveSamplePeak, GetActiveCount());
+
+	if (LastAdaptiveSampleTime > 0.0)
+	{
+		const double Elapsed = CurrentTime - LastAdaptiveSampleTime;
+		const double Weight = 1.0 - FMath::Exp2(-Elapsed / FMath::Max(Policy.AdaptiveHalfLife, 0.1f));
+		const double SampleRate = (TotalAcquisitions - AdaptiveSampleAcquisitions) / Elapsed;
+
+		AdaptiveAcquisitionRate = FMath::Lerp(AdaptiveAcquisitionRate, SampleRate, Weight);
+
+		// A spike is taken as is and only forgotten slowly, so the objects it needed stay around for a while
+		AdaptivePeakEstimate = FMath::Max<double>(SamplePeak, FMath::Lerp<double>(AdaptivePeakEstimate, SamplePeak, Weight));
+	}
+
+	AdaptiveSampleAcquisitions = TotalAcquisitions;
+	AdaptiveSamplePeak = GetActiveCount();
+	LastAdaptiveSampleTime = CurrentTime;
+
+	int32 DesiredSize = FMath::Max(FMath::CeilToInt32(AdaptivePeakEstimate * (1.0 + Policy.AdaptiveHeadroom)), Policy.MinPoolSize);
+	if (MaxPoolSize > 0)
+	{
+		DesiredSize = FMath::Min(DesiredSize, MaxPoolSize);
+	}
+
+	// Grow right away; shrink only once demand fell clearly below the target and acquisitions aren't picking up
+	const bool bShouldGrow = DesiredSize > AdaptiveTargetSize;
+	const bool bShouldShrink = DesiredSize < FMath::FloorToInt32(AdaptiveTargetSize * (1.0f - Policy.AdaptiveHysteresis))
+		&& AdaptiveAcquisitionRate <= AdaptiveTargetRate * (1.0f + Policy.AdaptiveHysteresis);
+	if (bShouldGrow || bShouldShrink)
+	{
+		UE_LOG(LogRavenPool, Verbose, TEXT("Adaptive target of pool for class %s: %d -> %d (peak %.1f, %.1f acquisitions/s)"),
+			*ObjectClass->GetName(), AdaptiveTargetSize, DesiredSize, AdaptivePeakEstimate, AdaptiveAcquisitionRate);
+
+		AdaptiveTargetSize = DesiredSize;
+		AdaptiveTargetRate = AdaptiveAcquisitionRate;
+		Counters->SetAdaptiveTargetSize(AdaptiveTargetSize);
+	}
+
+	// Grow through the time-sliced pre-warm, trim the objects that have been idle the longest
+	const int32 NumPlanned = NumObjects + PreWarmRemaining;
+	if (NumPlanned < AdaptiveTargetSize && IsValid(Factory))
+	{
+		QueueBackgroundPreWarm(AdaptiveTargetSize - NumPlanned);
+	}
+	else
+	{
+		while (NumObjects > AdaptiveTargetSize && !FreeList.IsEmpty())
+		{
+			DestroySlot(FreeList.GetOldest());
+		}
+	}
+}
+
+int32 FRavenPool::ValidatePool()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_Validate);
+
+	if (!Policy.bEnableValidation)
+	{
+		return 0;
+	}
+
+	TArray<int32, TInlineAllocator<16>> InvalidSlots;
+	for (TConstSetBitIterator<> It(OccupiedSlots); It; ++It)
+	{
+		if (!IsValidForReuse(Objects[It.GetIndex()]))
+		{
+			InvalidSlots.Add(It.GetIndex());
+		}
+	}
+
+	for (const int32 Index : InvalidSlots)
+	{
+		UE_LOG(LogRavenPool, Warning, TEXT("Removing invalid object from pool"));
+		DestroySlot(Index);
+	}
+
+	return InvalidSlots.Num();
+}
+
+void FRavenPool::SetPolicy(const FRavenPoolPolicy& InPolicy)
+{
+	const ERavenPoolAcquisitionStrategy PreviousStrategy = Policy.AcquisitionStrategy;
+	const float PreviousCellSize = Policy.SpatialHashCellSize;
+	const float PreviousShrinkInterval = Policy.ShrinkInterval;
+	const bool bWasAdaptive = Policy.bAdaptiveSizing;
+	Policy = InPolicy;
+
+	// Start adaptive sizing from the current size and let it decay from there, so pre-warmed objects aren't
+	// trimmed before any demand was observed
+	if (Policy.bAdaptiveSizing && !bWasAdaptive)
+	{
+		AdaptiveTargetSize = FMath::Max(NumObjects + PreWarmRemaining, Policy.MinPoolSize);
+		AdaptivePeakEstimate = AdaptiveTargetSize / (1.0 + Policy.AdaptiveHeadroom);
+		AdaptiveAcquisitionRate = 0.0;
+		AdaptiveTargetRate = TNumericLimits<double>::Max();
+		AdaptiveSamplePeak = GetActiveCount();
+		AdaptiveSampleAcquisitions = Counters->GetTotalAcquisitions();
+		LastAdaptiveSampleTime = FPlatformTime::Seconds();
+	}
+	Counters->SetAdaptiveTargetSize(GetAdaptiveTargetSize());
+
+	// Only pools that recycle on overflow pay for keeping the active objects in acquisition order
+	const bool bShouldTrackActiveOrder = Policy.OverflowPolicy == ERavenPoolOverflowPolicy::RecycleOldest;
+	if (bShouldTrackActiveOrder != bTrackActiveOrder)
+	{
+		bTrackActiveOrder = bShouldTrackActiveOrder;
+		RebuildActiveOrder();
+	}
+
+	// Reschedule shrinking on the next tick
+	if (Policy.ShrinkInterval != PreviousShrinkInterval)
+	{
+		NextShrinkTime = 0.0;
+	}
+
+	// Recreate acquisition strategy if it changed
+	if (!AcquisitionStrategy.IsValid() || Policy.AcquisitionStrategy != PreviousStrategy || Policy.SpatialHashCellSize != PreviousCellSize)
+	{
+		RecreateAcquisitionStrategy();
+	}
+
+	if (Policy.bNoAllocation && MaxPoolSize > 0)
+	{
+		Reserve(MaxPoolSize);
+	}
+}
+
+void FRavenPool::SetMaxPoolSize(const int32 InMaxSize)
+{
+	MaxPoolSize = InMaxSize;
+
+	if (Policy.bNoAllocation && MaxPoolSize > 0)
+	{
+		Reserve(MaxPoolSize);
+	}
+}
+
+void FRavenPool::Reserve(const int32 Capacity)
+{
+	Pool.Reserve(Capacity);
+	Objects.Reserve(Capacity);
+	LastUsedTimes.Reserve(Capacity);
+	OccupiedSlots.Reserve(Capacity);
+	ActiveSlots.Reserve(Capacity);
+	FreeList.Reserve(Capacity);
+	ObjectToIndex.Reserve(Capacity);
+
+	if (AcquisitionStrategy.IsValid())
+	{
+		AcquisitionStrategy->Reserve(Capacity);
+	}
+}
+
+int32 FRavenPool::FindInactiveObject(const FVector* Location)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_FindInactive);
+
+	if (!AcquisitionStrategy.IsValid())
+	{
+		RecreateAcquisitionStrategy();
+	}
+
+	return Location
+		       ? AcquisitionStrategy->FindInactiveObjectNear(Pool, FreeList, *Location)
+		       : AcquisitionStrategy->FindInactiveObject(Pool, FreeList);
+}
+
+void FRavenPool::RecreateAcquisitionStrategy()
+{
+	AcquisitionStrategy = FRavenPoolStrategyFactory::CreateStrategy(Policy);
+	AcquisitionStrategy->Reserve(Pool.Max());
+	bStrategyNeedsNotifications = AcquisitionStrategy->NeedsNotifications();
+	bStrategyNeedsLocations = AcquisitionStrategy->NeedsLocations();
+
+	if (!bStrategyNeedsNotifications)
+	{
+		return;
+	}
+
+	// Replay the current inactive objects, oldest first, so stateful strategies start in sync
+	for (int32 Index = FreeList.GetOldest(); Index != INDEX_NONE; Index = Pool[Index].FreeNext)
+	{
+		NotifyStrategyReleased(Index);
+	}
+}
+
+int32 FRavenPool::AllocateSlot(UObject* Object, const bool bIsActive, const double CurrentTime)
+{
+	int32 Index = FirstVacantSlot;
+	if (Index != INDEX_NONE)
+	{
+		FirstVacantSlot = Pool[Index].NextVacantSlot;
+	}
+	else
+	{
+		Index = Pool.AddDefaulted();
+		Objects.AddDefaulted();
+		OccupiedSlots.Add(false);
+		ActiveSlots.Add(false);
+		LastUsedTimes.Add(0.0);
+	}
+
+	FRavenPoolEntry& Entry = Pool[Index];
+	Entry.AcquireCount = bIsActive ? 1 : 0;
+	Entry.NextVacantSlot = INDEX_NONE;
+
+	Objects[Index] = Object;
+	LastUsedTimes[Index] = CurrentTime;
+	OccupiedSlots[Index] = true;
+	ActiveSlots[Index] = bIsActive;
+
+	ObjectToIndex.Add(Object, Index);
+	Counters->OnObjectCreated(bIsActive);
+	if (bIsActive)
+	{
+		LinkActive(Index);
+		AdaptiveSamplePeak = FMath::Max(AdaptiveSamplePeak, GetActiveCount());
+	}
+	else
+	{
+		FreeList.Push(Pool, Index);
+
+		if (bStrategyNeedsNotifications)
+		{
+			NotifyStrategyReleased(Index);
+		}
+	}
+
+	NumObjects++;
+	return Index;
+}
+
+void FRavenPool::DestroySlot(const int32 Index)
+{
+	FRavenPoolEntry& Entry = Pool[Index];
+	UObject* Object = Objects[Index];
+	checkSlow(OccupiedSlots[Index]);
+
+	if (IsValid(Object))
+	{
+		HookDispatch.OnPoolDestroy(Object);
+
+		if (IsValid(Factory))
+		{
+			Factory->DestroyPoolObject(Object);
+		}
+	}
+
+	const bool bWasActive = ActiveSlots[Index];
+	if (bWasActive)
+	{
+		UnlinkOwner(Index);
+		UnlinkActive(Index);
+	}
+	else if (Entry.Reservation != INDEX_NONE)
+	{
+		// The reservation gets a replacement on the next fill
+		const int32 ReservationIndex = Entry.Reservation;
+		UnreserveSlot(Index);
+		if (Reservations[ReservationIndex].NumPending++ == 0)
+		{
+			NumPendingReservations++;
+		}
+	}
+	else
+	{
+		FreeList.Remove(Pool, Index);
+
+		if (bStrategyNeedsNotifications)
+		{
+			AcquisitionStrategy->OnObjectRemoved(Index);
+		}
+	}
+	ObjectToIndex.Remove(Object);
+	Counters->OnObjectDestroyed(bWasActive);
+
+	Objects[Index] = nullptr;
+	OccupiedSlots[Index] = false;
+	ActiveSlots[Index] = false;
+	Entry.AcquireCount = 0;
+	Entry.Generation++;
+
+	// Push onto the vacant slot list for reuse; no other slot moves
+	Entry.NextVacantSlot = FirstVacantSlot;
+	FirstVacantSlot = Index;
+
+	NumObjects--;
+}
+
+void FRavenPool::ActivateSlot(const int32 Index, const double CurrentTime)
+{
+	checkSlow(OccupiedSlots[Index] && !ActiveSlots[Index]);
+
+	// Unlink from the free list, or from the reservation holding it (which the strategy no longer tracks)
+	const bool bWasReserved = Pool[Index].Reservation != INDEX_NONE;
+	if (bWasReserved)
+	{
+		UnreserveSlot(Index);
+	}
+	else
+	{
+		FreeList.Remove(Pool, Index);
+	}
+
+	if (Policy.bAdaptiveSizing)
+	{
+		// A static policy would have destroyed this object for idling and now created a new one
+		if (Policy.MaxIdleTime > 0.0f && !bWasReserved && CurrentTime - LastUsedTimes[Index] > Policy.MaxIdleTime)
+		{
+			Counters->OnCycleAvoided();
+		}
+		AdaptiveSamplePeak = FMath::Max(AdaptiveSamplePeak, GetActiveCount() + 1);
+	}
+
+	ActiveSlots[Index] = true;
+	LastUsedTimes[Index] = CurrentTime;
+	Pool[Index].AcquireCount++;
+	Counters->OnObjectReused();
+	LinkActive(Index);
+
+	if (bStrategyNeedsNotifications && !bWasReserved)
+	{
+		AcquisitionStrategy->OnObjectAcquired(Index);
+	}
+}
+
+void FRavenPool::DeactivateSlot(const int32 Index, const double CurrentTime)
+{
+	checkSlow(OccupiedSlots[Index] && ActiveSlots[Index]);
+
+	UnlinkOwner(Index);
+	UnlinkActive(Index);
+
+	ActiveSlots[Index] = false;
+	LastUsedTimes[Index] = CurrentTime;
+	Pool[Index].Generation++;
+	Counters->OnObjectReleased();
+
+	// Append to the free list as the most recently released entry
+	FreeList.Push(Pool, Index);
+
+	if (bStrategyNeedsNotifications)
+	{
+		NotifyStrategyReleased(Index);
+	}
+}
+
+void FRavenPool::LinkOwner(const int32 Index, const UObject* Owner)
+{
+	checkSlow(ActiveSlots[Index] && Pool[Index].OwnerList == INDEX_NONE);
+
+	const FObjectKey OwnerKey(Owner);
+	int32 ListIndex;
+	if (const int32* ExistingIndex = OwnerListsByKey.Find(OwnerKey))
+	{
+		ListIndex = *ExistingIndex;
+	}
+	else
+	{
+		FRavenPoolOwnerList NewList;
+		NewList.Owner = Owner;
+		NewList.OwnerKey = OwnerKey;
+		ListIndex = OwnerLists.Add(NewList);
+		OwnerListsByKey.Add(OwnerKey, ListIndex);
+	}
+
+	// Push to the front of the owner's list
+	FRavenPoolOwnerList& List = OwnerLists[ListIndex];
+	FRavenPoolEntry& Entry = Pool[Index];
+	Entry.OwnerList = ListIndex;
+	Entry.OwnerPrev = INDEX_NONE;
+	Entry.OwnerNext = List.Head;
+	if (List.Head != INDEX_NONE)
+	{
+		Pool[List.Head].OwnerPrev = Index;
+	}
+	List.Head = Index;
+	List.Num++;
+}
+
+void FRavenPool::UnlinkOwner(const int32 Index)
+{
+	FRavenPoolEntry& Entry = Pool[Index];
+	if (Entry.OwnerList == INDEX_NONE)
+	{
+		return;
+	}
+
+	FRavenPoolOwnerList& List = OwnerLists[Entry.OwnerList];
+	if (Entry.OwnerPrev != INDEX_NONE)
+	{
+		Pool[Entry.OwnerPrev].OwnerNext = Entry.OwnerNext;
+	}
+	else
+	{
+		List.Head = Entry.OwnerNext;
+	}
+	if (Entry.OwnerNext != INDEX_NONE)
+	{
+		Pool[Entry.OwnerNext].OwnerPrev = Entry.OwnerPrev;
+	}
+
+	if (--List.Num == 0)
+	{
+		OwnerListsByKey.Remove(List.OwnerKey);
+		OwnerLists.RemoveAt(Entry.OwnerList);
+	}
+
+	Entry.OwnerList = INDEX_NONE;
+	Entry.OwnerPrev = INDEX_NONE;
+	Entry.OwnerNext = INDEX_NONE;
+}
+
+int32 FRavenPool::ReleaseOwnerList(const int32 ListIndex, const double CurrentTime)
+{
+	int32 NumReleased = 0;
+
+	// Releasing or removing a slot unlinks it, so keep taking the head until the last entry freed the list
+	bool bHasMore = true;
+	while (bHasMore)
+	{
+		const FRavenPoolOwnerList& List = OwnerLists[ListIndex];
+		const int32 Index = List.Head;
+		bHasMore = List.Num > 1;
+
+		if (ReleaseSlot(Index, CurrentTime))
+		{
+			NumReleased++;
+		}
+		else
+		{
+			DestroySlot(Index);
+		}
+	}
+
+	return NumReleased;
+}
+
+void FRavenPool::ReclaimOrphanedObjects(const double CurrentTime)
+{
+	int32 Reclaimed = 0;
+
+	// Lists are only ever removed in place, so indices stay valid while releasing
+	for (int32 ListIndex = 0; ListIndex < OwnerLists.GetMaxIndex(); ++ListIndex)
+	{
+		if (OwnerLists.IsAllocated(ListIndex) && !OwnerLists[ListIndex].Owner.IsValid())
+		{
+			Reclaimed += ReleaseOwnerList(ListIndex, CurrentTime);
+		}
+	}
+
+	if (Reclaimed > 0)
+	{
+		UE_LOG(LogRavenPool, Log, TEXT("Returned %d objects of class %s whose owner was garbage collected"),
+			Reclaimed, *ObjectClass->GetName());
+	}
+}
+
+void FRavenPool::LinkActive(const int32 Index)
+{
+	if (!bTrackActiveOrder)
+	{
+		return;
+	}
+
+	FRavenPoolEntry& Entry = Pool[Index];
+	Entry.ActivePrev = NewestActive;
+	Entry.ActiveNext = INDEX_NONE;
+	if (NewestActive != INDEX_NONE)
+	{
+		Pool[NewestActive].ActiveNext = Index;
+	}
+	else
+	{
+		OldestActive = Index;
+	}
+	NewestActive = Index;
+}
+
+void FRavenPool::UnlinkActive(const int32 Index)
+{
+	if (!bTrackActiveOrder)
+	{
+		return;
+	}
+
+	FRavenPoolEntry& Entry = Pool[Index];
+	if (Entry.ActivePrev != INDEX_NONE)
+	{
+		Pool[Entry.ActivePrev].ActiveNext = Entry.ActiveNext;
+	}
+	else
+	{
+		OldestActive = Entry.ActiveNext;
+	}
+
+	if (Entry.ActiveNext != INDEX_NONE)
+	{
+		Pool[Entry.ActiveNext].ActivePrev = Entry.ActivePrev;
+	}
+	else
+	{
+		NewestActive = Entry.ActivePrev;
+	}
+
+	Entry.ActivePrev = INDEX_NONE;
+	Entry.ActiveNext = INDEX_NONE;
+}
+
+void FRavenPool::RebuildActiveOrder()
+{
+	OldestActive = INDEX_NONE;
+	NewestActive = INDEX_NONE;
+	for (FRavenPoolEntry& Entry : Pool)
+	{
+		Entry.ActivePrev = INDEX_NONE;
+		Entry.ActiveNext = INDEX_NONE;
+	}
+
+	if (!bTrackActiveOrder)
+	{
+		return;
+	}
+
+	// Active slots store their acquisition time, which gives the order to link them in
+	TArray<int32> ActiveIndices;
+	ActiveIndices.Reserve(GetActiveCount());
+	for (TConstSetBitIterator<> It(ActiveSlots); It; ++It)
+	{
+		ActiveIndices.Add(It.GetIndex());
+	}
+	ActiveIndices.Sort([this](const int32 A, const int32 B) { return LastUsedTimes[A] < LastUsedTimes[B]; });
+
+	for (const int32 Index : ActiveIndices)
+	{
+		LinkActive(Index);
+	}
+}
+
+int32 FRavenPool::RecycleOldestActive(const double CurrentTime)
+{
+	const int32 Index = OldestActive;
+	if (Index == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	UObject* Object = Objects[Index];
+	if (IsValid(Object))
+	{
+		HookDispatch.OnReclaimedByPool(Object);
+	}
+
+	// Releasing bumps the slot's generation, so the previous user's slot ids and timed releases go stale
+	if (!ReleaseSlot(Index, CurrentTime))
+	{
+		DestroySlot(Index);
+		return INDEX_NONE;
+	}
+
+	Counters->OnOverflowRecycled();
+	UE_LOG(LogRavenPool, Verbose, TEXT("Pool for class %s is full, recycled its oldest active object"), *ObjectClass->GetName());
+	return Index;
+}
+
+UObject* FRavenPool::CreateTransientObject()
+{
+	UObject* Object = Factory->CreatePoolObject(ObjectClass);
+	if (!IsValid(Object))
+	{
+		UE_LOG(LogRavenPool, Error, TEXT("Failed to create transient object of class %s"), *ObjectClass->GetName());
+		return nullptr;
+	}
+
+	TransientObjects.Add(Object);
+	Counters->OnTransientCreated();
+
+	UE_LOG(LogRavenPool, Verbose, TEXT("Pool for class %s is full, created a transient object (%d alive)"),
+		*ObjectClass->GetName(), TransientObjects.Num());
+	return Object;
+}
+
+bool FRavenPool::ReleaseTransient(UObject* Object)
+{
+	if (TransientObjects.Remove(Object) == 0)
+	{
+		return false;
+	}
+
+	HookDispatch.OnReturnedToPool(Object);
+	HookDispatch.OnPoolDestroy(Object);
+	Factory->DestroyPoolObject(Object);
+	Counters->OnTransientDestroyed();
+	return true;
+}
+
+void FRavenPool::PruneTransientObjects()
+{
+	int32 Pruned = 0;
+	for (TSet<TObjectPtr<UObject>>::TIterator It = TransientObjects.CreateIterator(); It; ++It)
+	{
+		// Garbage collection clears references to destroyed objects, so entries may also be null
+		if (!IsValid(*It))
+		{
+			It.RemoveCurrent();
+			Counters->OnTransientDestroyed();
+			Pruned++;
+		}
+	}
+
+	if (Pruned > 0)
+	{
+		UE_LOG(LogRavenPool, Verbose, TEXT("Forgot %d transient objects of class %s that were destroyed without being released"),
+			Pruned, *ObjectClass->GetName());
+	}
+}
+
+void FRavenPool::ReportOverflowFailure()
+{
+	Counters->OnOverflowFailed();
+
+	// Failing is the expected steady state of a capped pool, the counters keep track of every occurrence
+	if (!bOverflowWarned)
+	{
+		bOverflowWarned = true;
+		UE_LOG(LogRavenPool, Warning, TEXT("Cannot create new object: Pool for class %s has reached max size %d. Further failures are counted in the pool stats."),
+			*ObjectClass->GetName(), MaxPoolSize);
+	}
+	else
+	{
+		UE_LOG(LogRavenPool, Verbose, TEXT("Cannot create new object: Pool for class %s has reached max size %d"),
+			*ObjectClass->GetName(), MaxPoolSize);
+	}
+}
+
+FRavenPoolReservation* FRavenPool::FindReservation(const FRavenPoolReservationTicket& Ticket)
+{
+	if (Ticket.PoolId != PoolId || !Reservations.IsValidIndex(Ticket.Reservation))
+	{
+		return nullptr;
+	}
+
+	FRavenPoolReservation& Reservation = Reservations[Ticket.Reservation];
+	return Reservation.Serial == Ticket.Serial ? &Reservation : nullptr;
+}
+
+const FRavenPoolReservation* FRavenPool::FindReservation(const FRavenPoolReservationTicket& Ticket) const
+{
+	return const_cast<FRavenPool*>(this)->FindReservation(Ticket);
+}
+
+void FRavenPool::ReserveSlot(const int32 Index, const int32 ReservationIndex)
+{
+	checkSlow(OccupiedSlots[Index] && !ActiveSlots[Index] && Pool[Index].Reservation == INDEX_NONE);
+
+	FreeList.Remove(Pool, Index);
+	if (bStrategyNeedsNotifications)
+	{
+		AcquisitionStrategy->OnObjectRemoved(Index);
+	}
+
+	Pool[Index].Reservation = ReservationIndex;
+	Reservations[ReservationIndex].Slots.Add(Index);
+}
+
+void FRavenPool::UnreserveSlot(const int32 Index)
+{
+	FRavenPoolEntry& Entry = Pool[Index];
+	TArray<int32>& Slots = Reservations[Entry.Reservation].Slots;
+
+	// Reserved entries are taken from the back, so this is usually the last element
+	Slots.RemoveAtSwap(Slots.FindLast(Index), 1, EAllowShrinking::No);
+	Entry.Reservation = INDEX_NONE;
+}
+
+void FRavenPool::FreeReservation(const int32 ReservationIndex, const double CurrentTime)
+{
+	FRavenPoolReservation& Reservation = Reservations[ReservationIndex];
+	for (const int32 Index : Reservation.Slots)
+	{
+		Pool[Index].Reservation = INDEX_NONE;
+		LastUsedTimes[Index] = CurrentTime;
+		FreeList.Push(Pool, Index);
+
+		if (bStrategyNeedsNotifications)
+		{
+			NotifyStrategyReleased(Index);
+		}
+	}
+
+	if (Reservation.NumPending > 0)
+	{
+		NumPendingReservations--;
+	}
+	Reservations.RemoveAt(ReservationIndex);
+}
+
+void FRavenPool::NotifyStrategyReleased(const int32 Index)
+{
+	if (bStrategyNeedsLocations)
+	{
+		const UObject* Object = Objects[Index];
+		if (const AActor* Actor = Cast<AActor>(Object))
+		{
+			AcquisitionStrategy->SetObjectLocation(Index, Actor->GetActorLocation());
+		}
+		else if (const USceneComponent* Component = Cast<USceneComponent>(Object))
+		{
+			AcquisitionStrategy->SetObjectLocation(Index, Component->GetComponentLocation());
+		}
+	}
+
+	AcquisitionStrategy->OnObjectReleased(Index);
+}
+
+bool FRavenPool::ReleaseSlot(const int32 Index, const double CurrentTime)
+{
+	UObject* Object = Objects[Index];
+
+	if (!ActiveSlots[Index])
+	{
+		UE_LOG(LogRavenPool, Warning, TEXT("Attempted to release already inactive object of class %s"), *ObjectClass->GetName());
+		return false;
+	}
+
+	if (!IsValid(Object))
+	{
+		UE_LOG(LogRavenPool, Warning, TEXT("Attempted to release invalid object of class %s"), *ObjectClass->GetName());
+		return false;
+	}
+
+	RAVEN_POOL_NO_ALLOCATION_SCOPE(Policy.bNoAllocation, "FRavenPool::Release");
+
+	DeactivateSlot(Index, CurrentTime);
+
+	HookDispatch.OnReturnedToPool(Object);
+	HookDispatch.PrepareForStorage(Factory, Object);
+	return true;
+}
+
+FRavenPoolSlotId FRavenPool::MakeSlotId(const int32 Index) const
+{
+	FRavenPoolSlotId SlotId;
+	SlotId.PoolId = PoolId;
+	SlotId.Slot = Index;
+	SlotId.Generation = Pool[Index].Generation;
+	return SlotId;
+}
+
+bool FRavenPool::IsValidForReuse(UObject* Object) const
+{
+	return IsValid(Object) && HookDispatch.IsValidForReuse(Object);
 }
@@ -0,0 +1,48 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenPoolAcquireAsyncAction.h"
+#include "Pool/RavenPoolSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+URavenPoolAcquireAsyncAction* URavenPoolAcquireAsyncAction::AcquireAsync(UObject* WorldContextObject, UClass* Class)
+{
+	URavenPoolAcquireAsyncAction* Action = NewObject<URavenPoolAcquireAsyncAction>();
+	Action->WorldContextObject = WorldContextObject;
+	Action->Class = Class;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void URavenPoolAcquireAsyncAction::Activate()
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	URavenPoolSubsystem* Subsystem = World ? World->GetSubsystem<URavenPoolSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		HandleAcquired(nullptr);
+		return;
+	}
+
+	Subsystem->AcquireAsync(Class, [WeakThis = TWeakObjectPtr<URavenPoolAcquireAsyncAction>(this)](UObject* Object)
+	{
+		if (URavenPoolAcquireAsyncAction* This = WeakThis.Get())
+		{
+			This->HandleAcquired(Object);
+		}
+	});
+}
+
+void URavenPoolAcquireAsyncAction::HandleAcquired(UObject* Object)
+{
+	if (Object)
+	{
+		OnAcquired.Broadcast(Object);
+	}
+	else
+	{
+		OnFailed.Broadcast(nullptr);
+	}
+
+	SetReadyToDestroy();
+}
@@ -0,0 +1,129 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenPoolAllocationCheck.h"
+
+#if RAVEN_POOL_ALLOCATION_CHECKS
+
+#include "HAL/MemoryBase.h"
+#include "Misc/CommandLine.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRavenPoolAllocationCheck, Log, All);
+
+namespace RavenPoolAllocationCheck
+{
+	/** Allocations made by this thread while at least one scope was active */
+	thread_local uint64 ThreadAllocationCount = 0;
+
+	/** Number of active scopes on this thread */
+	thread_local int32 ThreadScopeDepth = 0;
+
+	/** Whether the counting allocator has been installed */
+	bool bInstalled = false;
+
+	/**
+	 * Forwards everything to the allocator it was installed in front of and counts the allocations made
+	 * inside no-allocation scopes.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInnerMalloc)
+			: InnerMalloc(InInnerMalloc)
+		{
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUsedOnCurrentThread() override { InnerMalloc->MarkTLSCachesAsUsedOnCurrentThread(); }
+		virtual void MarkTLSCachesAsUnusedOnCurrentThread() override { InnerMalloc->MarkTLSCachesAsUnusedOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+
+	private:
+		static void CountAllocation()
+		{
+			if (ThreadScopeDepth > 0)
+			{
+				++ThreadAllocationCount;
+			}
+		}
+
+	private:
+		FMalloc* InnerMalloc;
+	};
+}
+
+FRavenPoolNoAllocationScope::FRavenPoolNoAllocationScope(const bool bEnabled, const TCHAR* InContext)
+	: Context(InContext)
+	, bActive(bEnabled && RavenPoolAllocationCheck::bInstalled)
+{
+	if (bActive)
+	{
+		StartCount = RavenPoolAllocationCheck::ThreadAllocationCount;
+		++RavenPoolAllocationCheck::ThreadScopeDepth;
+	}
+}
+
+FRavenPoolNoAllocationScope::~FRavenPoolNoAllocationScope()
+{
+	if (!bActive)
+	{
+		return;
+	}
+
+	--RavenPoolAllocationCheck::ThreadScopeDepth;
+	const uint64 Allocations = RavenPoolAllocationCheck::ThreadAllocationCount - StartCount;
+	ensureMsgf(Allocations == 0, TEXT("%s performed %llu heap allocation(s) on a pool in no-allocation mode"), Context, Allocations);
+}
+
+void FRavenPoolNoAllocationScope::InstallIfRequested()
+{
+	check(IsInGameThread());
+
+	if (RavenPoolAllocationCheck::bInstalled || !FParse::Param(FCommandLine::Get(), TEXT("RavenPoolAllocationChecks")))
+	{
+		return;
+	}
+
+	// Blocks allocated before this point are still freed through the inner allocator, so swapping is safe.
+	// The proxy is never uninstalled.
+	GMalloc = new RavenPoolAllocationCheck::FCountingMalloc(GMalloc);
+	RavenPoolAllocationCheck::bInstalled = true;
+
+	UE_LOG(LogRavenPoolAllocationCheck, Log, TEXT("Counting allocations of pools in no-allocation mode"));
+}
+
+#endif
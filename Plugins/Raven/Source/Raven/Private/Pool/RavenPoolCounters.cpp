@@ -0,0 +1,38 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenPoolCounters.h"
+
+FRavenPoolStats FRavenPoolCounters::Snapshot() const
+{
+	FRavenPoolStats Stats;
+
+	uint32 SequenceBefore;
+	do
+	{
+		SequenceBefore = Sequence.load(std::memory_order_acquire);
+
+		Stats.TotalCount = TotalCount.load(std::memory_order_relaxed);
+		Stats.ActiveCount = ActiveCount.load(std::memory_order_relaxed);
+		Stats.PeakPoolSize = PeakPoolSize.load(std::memory_order_relaxed);
+		Stats.TotalCreated = TotalCreated.load(std::memory_order_relaxed);
+		Stats.TotalDestroyed = TotalDestroyed.load(std::memory_order_relaxed);
+		Stats.TotalAcquisitions = TotalAcquisitions.load(std::memory_order_relaxed);
+		Stats.TotalReleases = TotalReleases.load(std::memory_order_relaxed);
+		Stats.TotalReuses = TotalReuses.load(std::memory_order_relaxed);
+		Stats.TotalSynchronousCreations = TotalSynchronousCreations.load(std::memory_order_relaxed);
+		Stats.TransientCount = TransientCount.load(std::memory_order_relaxed);
+		Stats.TotalOverflowFailures = TotalOverflowFailures.load(std::memory_order_relaxed);
+		Stats.TotalOverflowRecycles = TotalOverflowRecycles.load(std::memory_order_relaxed);
+		Stats.TotalOverflowTransients = TotalOverflowTransients.load(std::memory_order_relaxed);
+		Stats.AdaptiveTargetSize = AdaptiveTargetSize.load(std::memory_order_relaxed);
+		Stats.TotalCyclesAvoided = TotalCyclesAvoided.load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+	// Retry if the game thread was mid-update or finished an update while we were reading
+	while ((SequenceBefore & 1) != 0 || SequenceBefore != Sequence.load(std::memory_order_relaxed));
+
+	Stats.InactiveCount = Stats.TotalCount - Stats.ActiveCount;
+	Stats.CalculateUsagePercent();
+	return Stats;
+}
@@ -5,9 +5,9 @@
 
 void FRavenPoolHandle::Release()
 {
-	if (Object.IsValid() && Subsystem.IsValid())
+	if (Subsystem.IsValid())
 	{
-		Subsystem->Release(Object.Get());
+		Subsystem->ReleaseSlot(SlotId);
 	}
 	bAutoRelease = false;
 }
@@ -0,0 +1,75 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenPoolHookDispatch.h"
+
+void FRavenPoolHookDispatch::Resolve(UClass* InObjectClass, const URavenPoolFactoryUObject* Factory)
+{
+	*this = FRavenPoolHookDispatch();
+
+	// Objects of a class that doesn't implement IPoolable keep every hook at None
+	ObjectClass = InObjectClass;
+	if (IsValid(InObjectClass) && InObjectClass->ImplementsInterface(UPoolable::StaticClass()))
+	{
+		// Classes implementing the interface in C++ expose it at a fixed offset, which the default object tells us
+		UObject* DefaultObject = InObjectClass->GetDefaultObject();
+		if (void* NativeInterface = DefaultObject->GetInterfaceAddress(UPoolable::StaticClass()))
+		{
+			PoolableOffset = static_cast<int32>(static_cast<uint8*>(NativeInterface) - reinterpret_cast<uint8*>(DefaultObject));
+		}
+
+		AcquiredDispatch = ResolvePoolableHook(GET_FUNCTION_NAME_CHECKED(IPoolable, OnAcquiredFromPool), AcquiredFunction);
+		ReturnedDispatch = ResolvePoolableHook(GET_FUNCTION_NAME_CHECKED(IPoolable, OnReturnedToPool), ReturnedFunction);
+		ReclaimedDispatch = ResolvePoolableHook(GET_FUNCTION_NAME_CHECKED(IPoolable, OnReclaimedByPool), ReclaimedFunction);
+		DestroyDispatch = ResolvePoolableHook(GET_FUNCTION_NAME_CHECKED(IPoolable, OnPoolDestroy), DestroyFunction);
+
+		UFunction* ValidForReuseFunction = nullptr;
+		ValidForReuseDispatch = ResolvePoolableHook(GET_FUNCTION_NAME_CHECKED(IPoolable, IsValidForReuse), ValidForReuseFunction);
+	}
+
+	if (IsValid(Factory))
+	{
+		FactoryClass = Factory->GetClass();
+		PrepareForUsageDispatch = ResolveFactoryHook(FactoryClass, GET_FUNCTION_NAME_CHECKED(URavenPoolFactoryUObject, PrepareForUsage));
+		PrepareForStorageDispatch = ResolveFactoryHook(FactoryClass, GET_FUNCTION_NAME_CHECKED(URavenPoolFactoryUObject, PrepareForStorage));
+	}
+}
+
+bool FRavenPoolHookDispatch::IsValidForReuse(UObject* Object) const
+{
+	if (Object->GetClass() != ObjectClass)
+	{
+		return !Object->Implements<UPoolable>() || IPoolable::Execute_IsValidForReuse(Object);
+	}
+
+	switch (ValidForReuseDispatch)
+	{
+	case ERavenPoolHookDispatch::Native:
+		return GetNativePoolable(Object)->IsValidForReuse_Implementation();
+	case ERavenPoolHookDispatch::Script:
+		return IPoolable::Execute_IsValidForReuse(Object);
+	default:
+		return true;
+	}
+}
+
+ERavenPoolHookDispatch FRavenPoolHookDispatch::ResolvePoolableHook(const FName FunctionName, UFunction*& OutFunction) const
+{
+	// A Blueprint override shows up as a script function on the class
+	UFunction* Function = ObjectClass->FindFunctionByName(FunctionName);
+	if (Function && !Function->HasAnyFunctionFlags(FUNC_Native))
+	{
+		OutFunction = Function;
+		return ERavenPoolHookDispatch::Script;
+	}
+
+	// Blueprint-only implementers without an override have nothing to call
+	return ObjectClass->GetDefaultObject()->GetInterfaceAddress(UPoolable::StaticClass())
+		       ? ERavenPoolHookDispatch::Native
+		       : ERavenPoolHookDispatch::None;
+}
+
+ERavenPoolHookDispatch FRavenPoolHookDispatch::ResolveFactoryHook(const UClass* Class, const FName FunctionName)
+{
+	const UFunction* Function = Class->FindFunctionByName(FunctionName);
+	return Function && !Function->HasAnyFunctionFlags(FUNC_Native) ? ERavenPoolHookDispatch::Script : ERavenPoolHookDispatch::Native;
+}
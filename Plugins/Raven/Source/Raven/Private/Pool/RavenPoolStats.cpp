@@ -9,11 +9,14 @@ DEFINE_STAT(STAT_Pool_PreWarm);
 DEFINE_STAT(STAT_Pool_ClearInactive);
 DEFINE_STAT(STAT_Pool_Tick);
 DEFINE_STAT(STAT_Pool_Validate);
-DEFINE_STAT(STAT_Pool_RebuildIndices);
 DEFINE_STAT(STAT_Pool_FindInactive);
+DEFINE_STAT(STAT_Pool_AcquireMany);
+DEFINE_STAT(STAT_Pool_ReleaseMany);
 
 DEFINE_STAT(STAT_PoolSubsystem_Acquire);
 DEFINE_STAT(STAT_PoolSubsystem_Release);
+DEFINE_STAT(STAT_PoolSubsystem_AcquireMany);
+DEFINE_STAT(STAT_PoolSubsystem_ReleaseMany);
 DEFINE_STAT(STAT_PoolSubsystem_Tick);
 DEFINE_STAT(STAT_PoolSubsystem_Initialize);
 DEFINE_STAT(STAT_PoolSubsystem_GetPool);
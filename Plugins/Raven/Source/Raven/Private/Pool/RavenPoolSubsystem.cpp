@@ -5,10 +5,16 @@
 #include "Pool/RavenPoolDeveloperSettings.h"
 #include "Pool/Factory/RavenPoolFactoryUObject.h"
 #include "Pool/RavenPoolStats.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/PackageName.h"
+#include "Algo/Sort.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogRavenPoolSubsystem, Log, All);
 
-UObject* URavenPoolSubsystem::Acquire(UClass* Class)
+UObject* URavenPoolSubsystem::Acquire(UClass* Class, UObject* Owner)
 {
 	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Acquire);
 
@@ -24,7 +30,57 @@ UObject* URavenPoolSubsystem::Acquire(UClass* Class)
 		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
 		return nullptr;
 	}
-	return Pool->Acquire();
+	if (!Owner)
+	{
+		return Pool->Acquire();
+	}
+
+	FRavenPoolSlotId SlotId;
+	return Pool->AcquireForOwner(Owner, SlotId);
+}
+
+UObject* URavenPoolSubsystem::AcquireNear(UClass* Class, const FVector& Location)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Acquire);
+
+	if (!IsValid(Class))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot acquire object: Class is invalid"));
+		return nullptr;
+	}
+
+	FRavenPool* Pool = GetPool(Class);
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
+		return nullptr;
+	}
+	return Pool->AcquireNear(Location);
+}
+
+UObject* URavenPoolSubsystem::AcquireAt(UClass* Class, const FTransform& Transform, const TFunctionRef<void(UObject*)> Initializer)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Acquire);
+
+	if (!IsValid(Class))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot acquire object: Class is invalid"));
+		return nullptr;
+	}
+
+	FRavenPool* Pool = GetPool(Class);
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
+		return nullptr;
+	}
+
+	return Pool->AcquireAt(Transform, Initializer);
+}
+
+UObject* URavenPoolSubsystem::AcquireAtTransform(UClass* Class, const FTransform& Transform)
+{
+	return AcquireAt(Class, Transform, [](UObject*) {});
 }
 
 bool URavenPoolSubsystem::Release(UObject* Object)
@@ -44,6 +100,472 @@ bool URavenPoolSubsystem::Release(UObject* Object)
 	return Pool->Release(Object);
 }
 
+int32 URavenPoolSubsystem::ReleaseAllForOwner(UObject* Owner)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_ReleaseMany);
+
+	if (!Owner)
+	{
+		return 0;
+	}
+
+	int32 NumReleased = 0;
+	for (const TUniquePtr<FRavenPool>& Pool : Pools)
+	{
+		if (Pool.IsValid())
+		{
+			NumReleased += Pool->ReleaseAllForOwner(Owner);
+		}
+	}
+	return NumReleased;
+}
+
+UObject* URavenPoolSubsystem::AcquireWithLifetime(UClass* Class, const float Lifetime, UObject* Owner)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Acquire);
+
+	if (!IsValid(Class))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot acquire object: Class is invalid"));
+		return nullptr;
+	}
+
+	FRavenPool* Pool = GetPool(Class);
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
+		return nullptr;
+	}
+
+	// Timed release goes by slot id, so the pool refuses transient overflow objects here
+	FRavenPoolSlotId SlotId;
+	UObject* Object = Pool->AcquireForOwner(Owner, SlotId);
+	if (Object)
+	{
+		ReleaseAfter(SlotId, Lifetime);
+	}
+	return Object;
+}
+
+UObject* URavenPoolSubsystem::AcquireForFrame(UClass* Class)
+{
+	return AcquireWithLifetime(Class, 0.0f);
+}
+
+void URavenPoolSubsystem::ReleaseAfter(const FRavenPoolSlotId& SlotId, const float Delay)
+{
+	if (!SlotId.IsSet())
+	{
+		return;
+	}
+
+	if (Delay <= 0.0f)
+	{
+		EndOfFrameReleases.Add(SlotId);
+	}
+	else
+	{
+		ReleaseWheel.Schedule(SlotId, GetWorld()->GetTimeSeconds() + Delay);
+	}
+}
+
+FRavenPoolReservationTicket URavenPoolSubsystem::ReserveBurst(UClass* Class, const int32 Count, const float Timeout)
+{
+	if (!IsValid(Class))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot reserve objects: Class is invalid"));
+		return FRavenPoolReservationTicket();
+	}
+
+	FRavenPool* Pool = GetPool(Class);
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
+		return FRavenPoolReservationTicket();
+	}
+	return Pool->ReserveBurst(Count, Timeout);
+}
+
+UObject* URavenPoolSubsystem::AcquireReserved(const FRavenPoolReservationTicket& Ticket)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Acquire);
+
+	FRavenPool* Pool = Ticket.IsSet() ? GetPoolById(Ticket.PoolId) : nullptr;
+	if (!Pool)
+	{
+		return nullptr;
+	}
+
+	FRavenPoolSlotId SlotId;
+	return Pool->AcquireReserved(Ticket, SlotId);
+}
+
+void URavenPoolSubsystem::CancelReservation(const FRavenPoolReservationTicket& Ticket)
+{
+	if (FRavenPool* Pool = Ticket.IsSet() ? GetPoolById(Ticket.PoolId) : nullptr)
+	{
+		Pool->CancelReservation(Ticket);
+	}
+}
+
+int32 URavenPoolSubsystem::GetReservedCount(const FRavenPoolReservationTicket& Ticket) const
+{
+	const FRavenPool* Pool = Ticket.IsSet() ? GetPoolById(Ticket.PoolId) : nullptr;
+	return Pool ? Pool->GetReservedCount(Ticket) : 0;
+}
+
+void URavenPoolSubsystem::ReleaseDeferred(UObject* Object)
+{
+	if (Object)
+	{
+		FDeferredRelease Release;
+		Release.Object = Object;
+		DeferredReleases.Enqueue(MoveTemp(Release));
+	}
+}
+
+void URavenPoolSubsystem::ReleaseSlotDeferred(const FRavenPoolSlotId& SlotId)
+{
+	if (SlotId.IsSet())
+	{
+		FDeferredRelease Release;
+		Release.SlotId = SlotId;
+		DeferredReleases.Enqueue(MoveTemp(Release));
+	}
+}
+
+void URavenPoolSubsystem::DrainDeferredReleases()
+{
+	check(IsInGameThread());
+
+	DeferredObjects.Reset();
+	DeferredSlotIds.Reset();
+
+	FDeferredRelease Release;
+	while (DeferredReleases.Dequeue(Release))
+	{
+		if (Release.SlotId.IsSet())
+		{
+			DeferredSlotIds.Add(Release.SlotId);
+		}
+		else if (UObject* Object = Release.Object.Get())
+		{
+			DeferredObjects.Add(Object);
+		}
+	}
+
+	// Group the releases by pool so each pool prepares its objects for storage in one batch
+	if (!DeferredObjects.IsEmpty())
+	{
+		Algo::SortBy(DeferredObjects, [](const UObject* Object) { return Object->GetClass(); });
+		ReleaseMany(DeferredObjects);
+	}
+
+	if (!DeferredSlotIds.IsEmpty())
+	{
+		Algo::SortBy(DeferredSlotIds, &FRavenPoolSlotId::PoolId);
+		ReleaseSlots(DeferredSlotIds);
+	}
+}
+
+FRavenConcurrentPool* URavenPoolSubsystem::GetConcurrentPool(UClass* ObjectClass)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(ObjectClass) || ObjectClass->IsChildOf(AActor::StaticClass()))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Concurrent pools can only hold non-actor objects, got class %s"), *GetNameSafe(ObjectClass));
+		return nullptr;
+	}
+
+	if (const TUniquePtr<FRavenConcurrentPool>* Existing = ConcurrentPools.Find(ObjectClass))
+	{
+		return Existing->Get();
+	}
+
+	const TObjectPtr<URavenPoolFactoryUObject>* FoundFactory = Factories.Find(ObjectClass);
+	if (!FoundFactory || !IsValid(*FoundFactory))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No factory registered for class %s"), *ObjectClass->GetName());
+		return nullptr;
+	}
+
+	FRavenConcurrentPool* NewPool = ConcurrentPools.Add(ObjectClass, MakeUnique<FRavenConcurrentPool>(ObjectClass, *FoundFactory)).Get();
+
+	// Configure the pool like the regular pool of the class
+	const URavenPoolDeveloperSettings* PoolSettings = GetDefault<URavenPoolDeveloperSettings>();
+	for (const FRavenPoolConfig& PoolConfig : PoolSettings->GetPoolConfigs())
+	{
+		if (PoolConfig.Class.Get() == ObjectClass)
+		{
+			NewPool->SetMaxPoolSize(PoolConfig.MaxPoolSize);
+			NewPool->PreWarm(PoolConfig.InitialPoolSize);
+			break;
+		}
+	}
+
+	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Created concurrent pool for class %s"), *ObjectClass->GetName());
+	return NewPool;
+}
+
+void URavenPoolSubsystem::AcquireAsync(UClass* Class, TUniqueFunction<void(UObject*)> OnAcquired)
+{
+	check(IsInGameThread());
+
+	// Requests for pools that are still loading wait for them
+	if (IsValid(Class) && IsPoolLoading(Class))
+	{
+		FPendingAsyncAcquire& Pending = PendingAsyncAcquisitions.AddDefaulted_GetRef();
+		Pending.Class = Class;
+		Pending.OnAcquired = MoveTemp(OnAcquired);
+		return;
+	}
+
+	FRavenPool* Pool = IsValid(Class) ? GetPool(Class) : nullptr;
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot acquire object asynchronously: no pool for class %s"), *GetNameSafe(Class));
+		OnAcquired(nullptr);
+		return;
+	}
+
+	// Reusing a free object is cheap, only creation is deferred. Reserved objects are inactive but not free.
+	if (Pool->HasFreeObject())
+	{
+		OnAcquired(Pool->Acquire());
+		return;
+	}
+
+	FPendingAsyncAcquire& Pending = PendingAsyncAcquisitions.AddDefaulted_GetRef();
+	Pending.Class = Class;
+	Pending.OnAcquired = MoveTemp(OnAcquired);
+}
+
+UE::Tasks::TTask<UObject*> URavenPoolSubsystem::AcquireAsync(UClass* Class)
+{
+	// The result task runs inline on the game thread as soon as the object is handed over
+	TSharedRef<UObject*, ESPMode::ThreadSafe> Result = MakeShared<UObject*, ESPMode::ThreadSafe>(nullptr);
+	UE::Tasks::FTaskEvent Acquired(TEXT("RavenPoolAcquireAsync"));
+	UE::Tasks::TTask<UObject*> Task = UE::Tasks::Launch(TEXT("RavenPoolAcquireAsyncResult"),
+		[Result]() { return *Result; },
+		UE::Tasks::Prerequisites(Acquired),
+		UE::Tasks::ETaskPriority::Normal,
+		UE::Tasks::EExtendedTaskPriority::Inline);
+
+	AcquireAsync(Class, [Result, Acquired](UObject* Object) mutable
+	{
+		*Result = Object;
+		Acquired.Trigger();
+	});
+	return Task;
+}
+
+void URavenPoolSubsystem::ProcessAsyncAcquisitions(const double Deadline)
+{
+	// Always serve at least one request so a tight budget still makes progress
+	const int32 NumPending = PendingAsyncAcquisitions.Num();
+	int32 NumVisited = 0;
+	int32 NumServed = 0;
+	int32 NumWaiting = 0;
+	while (NumVisited < NumPending && (NumServed == 0 || FPlatformTime::Seconds() < Deadline))
+	{
+		const int32 Index = NumVisited++;
+		UClass* Class = PendingAsyncAcquisitions[Index].Class.Get();
+
+		// Requests for pools that are still loading keep their place in the queue
+		if (Class && IsPoolLoading(Class))
+		{
+			if (NumWaiting != Index)
+			{
+				PendingAsyncAcquisitions[NumWaiting] = MoveTemp(PendingAsyncAcquisitions[Index]);
+			}
+			NumWaiting++;
+			continue;
+		}
+
+		// Moved out, the callback may queue new requests and grow the array
+		FPendingAsyncAcquire Pending = MoveTemp(PendingAsyncAcquisitions[Index]);
+		NumServed++;
+
+		// Created inactive within the budget first, so the acquisition reuses it instead of counting as a
+		// synchronous creation
+		FRavenPool* Pool = Class ? GetPool(Class) : nullptr;
+		if (Pool && !Pool->HasFreeObject() && Pool->HasCapacity())
+		{
+			Pool->CreateInactiveObject();
+		}
+		Pending.OnAcquired(Pool ? Pool->Acquire() : nullptr);
+	}
+
+	// Callbacks may have queued new requests behind the visited ones
+	PendingAsyncAcquisitions.RemoveAt(NumWaiting, NumVisited - NumWaiting, EAllowShrinking::No);
+}
+
+int32 URavenPoolSubsystem::ReleaseSlots(const TConstArrayView<FRavenPoolSlotId> SlotIds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_ReleaseMany);
+
+	int32 NumReleased = 0;
+	int32 RunStart = 0;
+	while (RunStart < SlotIds.Num())
+	{
+		// Release each run of ids of the same pool with one pool lookup
+		const int32 PoolId = SlotIds[RunStart].PoolId;
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < SlotIds.Num() && SlotIds[RunEnd].PoolId == PoolId)
+		{
+			++RunEnd;
+		}
+
+		if (FRavenPool* Pool = GetPoolById(PoolId))
+		{
+			NumReleased += Pool->ReleaseMany(SlotIds.Slice(RunStart, RunEnd - RunStart));
+		}
+		RunStart = RunEnd;
+	}
+	return NumReleased;
+}
+
+void URavenPoolSubsystem::HandleEndFrame()
+{
+	if (EndOfFrameReleases.IsEmpty())
+	{
+		return;
+	}
+
+	// Objects acquired for a frame from within the release hooks are released at the end of the next one
+	TArray<FRavenPoolSlotId> Releases = MoveTemp(EndOfFrameReleases);
+	ReleaseSlots(Releases);
+
+	Releases.Reset();
+	if (EndOfFrameReleases.IsEmpty())
+	{
+		EndOfFrameReleases = MoveTemp(Releases);
+	}
+	else
+	{
+		EndOfFrameReleases.Append(Releases);
+	}
+}
+
+int32 URavenPoolSubsystem::AcquireMany(UClass* Class, const int32 Count, TArray<UObject*>& OutObjects)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_AcquireMany);
+
+	OutObjects.Reset();
+
+	if (!IsValid(Class))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot acquire objects: Class is invalid"));
+		return 0;
+	}
+
+	FRavenPool* Pool = GetPool(Class);
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
+		return 0;
+	}
+	return Pool->AcquireMany(Count, OutObjects);
+}
+
+int32 URavenPoolSubsystem::AcquireManyAtTransforms(UClass* Class, const TArray<FTransform>& Transforms, TArray<UObject*>& OutObjects)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_AcquireMany);
+
+	OutObjects.Reset();
+
+	if (!IsValid(Class))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot acquire objects: Class is invalid"));
+		return 0;
+	}
+
+	FRavenPool* Pool = GetPool(Class);
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
+		return 0;
+	}
+	return Pool->AcquireManyAtTransforms(Transforms, OutObjects);
+}
+
+int32 URavenPoolSubsystem::ReleaseMany(const TArray<UObject*>& Objects)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_ReleaseMany);
+
+	int32 NumReleased = 0;
+	int32 RunStart = 0;
+	while (RunStart < Objects.Num())
+	{
+		if (!IsValid(Objects[RunStart]))
+		{
+			++RunStart;
+			continue;
+		}
+
+		// Release each run of objects of the same class with one pool lookup
+		const UClass* RunClass = Objects[RunStart]->GetClass();
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < Objects.Num() && IsValid(Objects[RunEnd]) && Objects[RunEnd]->GetClass() == RunClass)
+		{
+			++RunEnd;
+		}
+
+		if (FRavenPool* Pool = GetPool(Objects[RunStart]->GetClass()))
+		{
+			NumReleased += Pool->ReleaseMany(MakeArrayView(Objects).Slice(RunStart, RunEnd - RunStart));
+		}
+		RunStart = RunEnd;
+	}
+	return NumReleased;
+}
+
+UObject* URavenPoolSubsystem::AcquireSlot(UClass* Class, FRavenPoolSlotId& OutSlotId)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Acquire);
+
+	OutSlotId = FRavenPoolSlotId();
+
+	if (!IsValid(Class))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot acquire object: Class is invalid"));
+		return nullptr;
+	}
+
+	FRavenPool* Pool = GetPool(Class);
+	if (!Pool)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No pool found for class %s. Make sure a factory is registered for this class."), *Class->GetName());
+		return nullptr;
+	}
+	return Pool->Acquire(OutSlotId);
+}
+
+bool URavenPoolSubsystem::ReleaseSlot(const FRavenPoolSlotId& SlotId)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Release);
+
+	FRavenPool* Pool = GetPoolById(SlotId.PoolId);
+	if (!Pool)
+	{
+		return false;
+	}
+	return Pool->Release(SlotId);
+}
+
+bool URavenPoolSubsystem::IsSlotValid(const FRavenPoolSlotId& SlotId) const
+{
+	const FRavenPool* Pool = GetPoolById(SlotId.PoolId);
+	return Pool && Pool->IsValidSlotId(SlotId);
+}
+
+UObject* URavenPoolSubsystem::ResolveSlot(const FRavenPoolSlotId& SlotId) const
+{
+	const FRavenPool* Pool = GetPoolById(SlotId.PoolId);
+	return Pool ? Pool->ResolveSlotId(SlotId) : nullptr;
+}
+
 void URavenPoolSubsystem::AddFactory(UClass* Class, const TSubclassOf<URavenPoolFactoryUObject> FactoryClass)
 {
 	UObject* FactoryUObject = NewObject<UObject>(this, FactoryClass.Get());
@@ -64,6 +586,20 @@ void URavenPoolSubsystem::RemoveFactory(UClass* Class)
 	}
 }
 
+void URavenPoolSubsystem::PreWarmAsync(UClass* ObjectClass, const int32 Count)
+{
+	if (!IsValid(ObjectClass))
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot pre-warm pool: Class is invalid"));
+		return;
+	}
+
+	if (FRavenPool* Pool = GetPool(ObjectClass))
+	{
+		PreWarmQueued += Pool->PreWarmAsync(Count);
+	}
+}
+
 void URavenPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	SCOPE_CYCLE_COUNTER(STAT_PoolSubsystem_Initialize);
@@ -72,43 +608,192 @@ void URavenPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Initializing RavenPoolSubsystem"));
 
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &URavenPoolSubsystem::HandleEndFrame);
+
+	// Loaded before any pool is registered, the profile decides how far the pools are pre-warmed
 	const URavenPoolDeveloperSettings* PoolSettings = GetDefault<URavenPoolDeveloperSettings>();
+	const FString MapName = GetMapName();
+	if (PoolSettings->ShouldPreWarmFromUsageProfiles())
+	{
+		FRavenPoolUsageProfile Profile;
+		if (FRavenPoolUsageProfile::LoadFromFile(FRavenPoolUsageProfile::GetProfileFilename(MapName), Profile))
+		{
+			UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Loaded pool usage profile of %s merged from %d runs"), *MapName, Profile.NumRuns);
+			UsageProfile = MoveTemp(Profile);
+		}
+	}
+
+	bRecordingUsage = PoolSettings->ShouldRecordUsageProfiles();
+	RecordedUsage.Map = MapName;
+	RecordedUsage.SampleInterval = PoolSettings->GetUsageProfileSampleInterval();
+
+	TSet<FSoftObjectPath> ConfiguredClasses;
 	for (const FRavenPoolConfig& PoolConfig : PoolSettings->GetPoolConfigs())
 	{
-		if (PoolConfig.Class && !PoolConfig.Factory.IsNull())
+		if (PoolConfig.Class.IsNull() || PoolConfig.Factory.IsNull())
 		{
-			if (const TSubclassOf<URavenPoolFactoryUObject> FactoryClass = PoolConfig.Factory.LoadSynchronous())
+			continue;
+		}
+
+		if (!IsPoolConfigUsedInWorld(PoolConfig))
+		{
+			UE_LOG(LogRavenPoolSubsystem, Verbose, TEXT("Skipping pool for class %s, it is not used in this map"),
+			       *PoolConfig.Class.ToString());
+			continue;
+		}
+
+		// Configs for other maps may share a class, but a world only has one pool per class
+		const FSoftObjectPath ClassPath = PoolConfig.Class.ToSoftObjectPath();
+		bool bAlreadyConfigured = false;
+		ConfiguredClasses.Add(ClassPath, &bAlreadyConfigured);
+		if (bAlreadyConfigured)
+		{
+			UE_LOG(LogRavenPoolSubsystem, Warning, TEXT("Pool for class %s is configured more than once for this map, ignoring the later entry"),
+			       *ClassPath.ToString());
+			continue;
+		}
+
+		// Classes and factories already in memory, such as native ones, come online right away
+		if (PoolConfig.Class.Get() && PoolConfig.Factory.Get())
+		{
+			RegisterPoolConfig(PoolConfig);
+			continue;
+		}
+
+		// Registered before requesting, the load may complete immediately. The config is copied into the
+		// callback, so settings edited while loading don't change which pool comes online.
+		PoolLoadHandles.Add(ClassPath);
+
+		TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			{ClassPath, PoolConfig.Factory.ToSoftObjectPath()},
+			FStreamableDelegate::CreateUObject(this, &URavenPoolSubsystem::HandlePoolConfigLoaded, PoolConfig));
+
+		if (TSharedPtr<FStreamableHandle>* LoadHandle = PoolLoadHandles.Find(ClassPath))
+		{
+			*LoadHandle = MoveTemp(Handle);
+		}
+	}
+}
+
+bool URavenPoolSubsystem::IsPoolConfigUsedInWorld(const FRavenPoolConfig& PoolConfig) const
+{
+	if (PoolConfig.Maps.IsEmpty())
+	{
+		return true;
+	}
+
+	const FString MapName = GetMapName();
+	return PoolConfig.Maps.ContainsByPredicate([&MapName](const TSoftObjectPtr<UWorld>& Map)
+	{
+		return Map.ToSoftObjectPath().GetLongPackageName() == MapName;
+	});
+}
+
+FString URavenPoolSubsystem::GetMapName() const
+{
+	return UWorld::RemovePIEPrefix(GetWorld()->GetPackage()->GetName());
+}
+
+void URavenPoolSubsystem::RegisterPoolConfig(const FRavenPoolConfig& PoolConfig)
+{
+	UClass* Class = PoolConfig.Class.Get();
+	const TSubclassOf<URavenPoolFactoryUObject> FactoryClass = PoolConfig.Factory.Get();
+	if (!Class || !FactoryClass)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Failed to load class or factory for pool %s"), *PoolConfig.Class.ToString());
+		return;
+	}
+
+	AddFactory(Class, FactoryClass);
+	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Registered factory %s for class %s"),
+	       *FactoryClass->GetName(), *Class->GetName());
+
+	// Get or create the pool and configure it
+	if (FRavenPool* Pool = GetPool(Class))
+	{
+		Pool->SetMaxPoolSize(PoolConfig.MaxPoolSize);
+		Pool->SetPolicy(PoolConfig.Policy);
+
+		// Pre-warm to the peak this map needed in its recorded runs: what the first window used right away, the
+		// rest within the pre-warm budget
+		const FRavenPoolClassUsage* Usage = UsageProfile.IsSet() ? UsageProfile->FindClass(PoolConfig.Class.ToSoftObjectPath()) : nullptr;
+		if (Usage && Usage->PeakActive > 0)
+		{
+			const int32 FirstWindowPeak = Usage->ActiveCurve.IsEmpty() ? Usage->PeakActive : Usage->ActiveCurve[0];
+			const int32 NumUpFront = PoolConfig.bPreWarmAsync ? 0 : FMath::Min(FirstWindowPeak, Usage->PeakActive);
+			if (NumUpFront > 0)
 			{
-				AddFactory(PoolConfig.Class, FactoryClass);
-				UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Registered factory %s for class %s"),
-				       *FactoryClass->GetName(), *PoolConfig.Class->GetName());
-
-				// Get or create the pool and configure it
-				if (FRavenPool* Pool = GetPool(PoolConfig.Class))
-				{
-					Pool->SetMaxPoolSize(PoolConfig.MaxPoolSize);
-					Pool->SetPolicy(PoolConfig.Policy);
-
-					// Pre-warm the pool if configured
-					if (PoolConfig.InitialPoolSize > 0)
-					{
-						Pool->PreWarm(PoolConfig.InitialPoolSize);
-					}
-				}
+				Pool->PreWarm(NumUpFront);
 			}
-			else
+			if (Usage->PeakActive > NumUpFront)
 			{
-				UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Failed to load factory for class %s"),
-				       *PoolConfig.Class->GetName());
+				PreWarmQueued += Pool->PreWarmAsync(Usage->PeakActive - NumUpFront);
 			}
+
+			UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Pre-warming pool for class %s from usage profile: %d up front, %d in total"),
+			       *Class->GetName(), NumUpFront, Usage->PeakActive);
 		}
+		// Pre-warm the pool if configured, cosmetic pools may fill up while the world is already playing
+		else if (PoolConfig.InitialPoolSize > 0 && PoolConfig.bPreWarmAsync)
+		{
+			PreWarmQueued += Pool->PreWarmAsync(PoolConfig.InitialPoolSize);
+		}
+		else if (PoolConfig.InitialPoolSize > 0)
+		{
+			Pool->PreWarm(PoolConfig.InitialPoolSize);
+		}
+
+		OnPoolLoaded.Broadcast(Class);
 	}
 }
 
+void URavenPoolSubsystem::HandlePoolConfigLoaded(const FRavenPoolConfig PoolConfig)
+{
+	PoolLoadHandles.Remove(PoolConfig.Class.ToSoftObjectPath());
+	RegisterPoolConfig(PoolConfig);
+}
+
+bool URavenPoolSubsystem::IsPoolLoading(const UClass* ObjectClass) const
+{
+	return ObjectClass && !PoolLoadHandles.IsEmpty() && PoolLoadHandles.Contains(FSoftObjectPath(ObjectClass));
+}
+
 void URavenPoolSubsystem::Deinitialize()
 {
 	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Deinitializing RavenPoolSubsystem"));
 
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	// Pools still loading never come online
+	for (TTuple<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : PoolLoadHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+	PoolLoadHandles.Empty();
+	EndOfFrameReleases.Empty();
+	ReleaseWheel.Reset();
+	DeferredReleases.Empty();
+	PreWarmQueued = 0;
+	PreWarmDone = 0;
+
+	if (bRecordingUsage)
+	{
+		SaveUsageProfile();
+		bRecordingUsage = false;
+	}
+	RecordedUsage = FRavenPoolUsageProfile();
+	UsageProfile.Reset();
+
+	// Fail the asynchronous acquisitions that never got their object
+	TArray<FPendingAsyncAcquire> Unserved = MoveTemp(PendingAsyncAcquisitions);
+	for (FPendingAsyncAcquire& Pending : Unserved)
+	{
+		Pending.OnAcquired(nullptr);
+	}
+
 	for (TTuple<TObjectPtr<UClass>, TObjectPtr<URavenPoolFactoryUObject>>& Iterator : Factories)
 	{
 		if (IsValid(Iterator.Value))
@@ -117,7 +802,9 @@ void URavenPoolSubsystem::Deinitialize()
 		}
 	}
 	Factories.Empty();
+	PoolIdsByClass.Empty();
 	Pools.Empty();
+	ConcurrentPools.Empty();
 
 	Super::Deinitialize();
 }
@@ -137,21 +824,32 @@ FRavenPool* URavenPoolSubsystem::GetPool(UClass* ObjectClass)
 		return nullptr;
 	}
 
-	FRavenPool* Pool = Pools.FindByKey(ObjectClass);
-	if (!Pool)
+	if (const int32* PoolId = PoolIdsByClass.Find(ObjectClass))
 	{
-		const TObjectPtr<URavenPoolFactoryUObject>* FoundFactory = Factories.Find(ObjectClass);
-		if (!FoundFactory || !IsValid(*FoundFactory))
+		return Pools[*PoolId].Get();
+	}
+
+	const TObjectPtr<URavenPoolFactoryUObject>* FoundFactory = Factories.Find(ObjectClass);
+	if (!FoundFactory || !IsValid(*FoundFactory))
+	{
+		if (IsPoolLoading(ObjectClass))
 		{
-			UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No factory registered for class %s"), *ObjectClass->GetName());
+			UE_LOG(LogRavenPoolSubsystem, Warning, TEXT("Pool for class %s is still loading"), *ObjectClass->GetName());
 			return nullptr;
 		}
 
-		Pool = &Pools.AddDefaulted_GetRef();
-		Pool->ObjectClass = ObjectClass;
-		Pool->Factory = *FoundFactory;
-		UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Created new pool for class %s"), *ObjectClass->GetName());
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("No factory registered for class %s"), *ObjectClass->GetName());
+		return nullptr;
 	}
+
+	const int32 PoolId = Pools.Num();
+	FRavenPool* Pool = Pools.Add_GetRef(MakeUnique<FRavenPool>()).Get();
+	Pool->PoolId = PoolId;
+	Pool->ObjectClass = ObjectClass;
+	Pool->Factory = *FoundFactory;
+	Pool->HookDispatch.Resolve(ObjectClass, *FoundFactory);
+	PoolIdsByClass.Add(ObjectClass, PoolId);
+	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Created new pool for class %s"), *ObjectClass->GetName());
 	return Pool;
 }
 
@@ -161,7 +859,19 @@ const FRavenPool* URavenPoolSubsystem::GetPoolForClass(UClass* ObjectClass) cons
 	{
 		return nullptr;
 	}
-	return Pools.FindByKey(ObjectClass);
+
+	const int32* PoolId = PoolIdsByClass.Find(ObjectClass);
+	return PoolId ? Pools[*PoolId].Get() : nullptr;
+}
+
+FRavenPool* URavenPoolSubsystem::GetPoolById(const int32 PoolId)
+{
+	return Pools.IsValidIndex(PoolId) ? Pools[PoolId].Get() : nullptr;
+}
+
+const FRavenPool* URavenPoolSubsystem::GetPoolById(const int32 PoolId) const
+{
+	return Pools.IsValidIndex(PoolId) ? Pools[PoolId].Get() : nullptr;
 }
 
 void URavenPoolSubsystem::Tick(float DeltaTime)
@@ -170,10 +880,89 @@ void URavenPoolSubsystem::Tick(float DeltaTime)
 
 	Super::Tick(DeltaTime);
 
-	// Tick all pools for maintenance (idle cleanup, periodic shrinking, etc.)
-	for (FRavenPool& Pool : Pools)
+	// Release everything queued from other threads or deferred to this point
+	if (!DeferredReleases.IsEmpty())
+	{
+		DrainDeferredReleases();
+	}
+
+	// Release the objects whose lifetime ran out, in one batch
+	if (ReleaseWheel.Num() > 0)
 	{
-		Pool.Tick(DeltaTime);
+		ExpiredReleases.Reset();
+		ReleaseWheel.Advance(GetWorld()->GetTimeSeconds(), ExpiredReleases);
+		ReleaseSlots(ExpiredReleases);
+	}
+
+	// Create the objects asynchronous acquisitions and reservations are waiting for, sharing one budget
+	const double CreationDeadline = FPlatformTime::Seconds() + GetDefault<URavenPoolDeveloperSettings>()->GetAsyncCreationBudget();
+	if (!PendingAsyncAcquisitions.IsEmpty())
+	{
+		ProcessAsyncAcquisitions(CreationDeadline);
+	}
+
+	for (const TUniquePtr<FRavenPool>& Pool : Pools)
+	{
+		if (Pool.IsValid() && Pool->HasPendingReservations())
+		{
+			Pool->FillReservations(CreationDeadline);
+		}
+	}
+
+	// Fill the pools pre-warming asynchronously within their own budget, topping up the ones below their low
+	// watermark on the way
+	double PreWarmDeadline = 0.0;
+	for (const TUniquePtr<FRavenPool>& Pool : Pools)
+	{
+		if (Pool.IsValid() && Pool->NeedsReplenishment())
+		{
+			Pool->Replenish();
+		}
+
+		if (Pool.IsValid() && Pool->IsPreWarming())
+		{
+			if (PreWarmDeadline == 0.0)
+			{
+				PreWarmDeadline = FPlatformTime::Seconds() + GetDefault<URavenPoolDeveloperSettings>()->GetPreWarmBudget();
+			}
+			const int32 NumProcessed = Pool->TickPreWarm(PreWarmDeadline);
+			PreWarmDone += IsPreWarming() ? NumProcessed : 0;
+		}
+	}
+
+	// Progress covers the pre-warms started through the subsystem
+	if (IsPreWarming())
+	{
+		PreWarmDone = FMath::Min(PreWarmDone, PreWarmQueued);
+		const int32 NumTotal = PreWarmQueued;
+		if (PreWarmDone == PreWarmQueued)
+		{
+			UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Finished pre-warming %d objects"), NumTotal);
+			PreWarmQueued = 0;
+			PreWarmDone = 0;
+		}
+		OnPreWarmProgress.Broadcast(PreWarmQueued > 0 ? PreWarmDone : NumTotal, NumTotal);
+	}
+
+	// Grow the concurrent pools that ran dry on worker threads
+	for (TTuple<TObjectPtr<UClass>, TUniquePtr<FRavenConcurrentPool>>& Pair : ConcurrentPools)
+	{
+		Pair.Value->Tick();
+	}
+
+	if (bRecordingUsage)
+	{
+		RecordUsage();
+	}
+
+	// Tick the pools that have maintenance due (idle cleanup, periodic shrinking, etc.)
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (const TUniquePtr<FRavenPool>& Pool : Pools)
+	{
+		if (CurrentTime >= Pool->GetNextMaintenanceTime())
+		{
+			Pool->Tick(CurrentTime);
+		}
 	}
 }
 
@@ -182,6 +971,23 @@ TStatId URavenPoolSubsystem::GetStatId() const
 	RETURN_QUICK_DECLARE_CYCLE_STAT(URavenPoolSubsystem, STATGROUP_Tickables);
 }
 
+void URavenPoolSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	// Pools are not reflected properties, so report the objects they hold through FRavenPool's own properties
+	URavenPoolSubsystem* This = CastChecked<URavenPoolSubsystem>(InThis);
+	for (const TUniquePtr<FRavenPool>& Pool : This->Pools)
+	{
+		Collector.AddPropertyReferencesWithStructARO(FRavenPool::StaticStruct(), Pool.Get(), This);
+	}
+
+	for (TTuple<TObjectPtr<UClass>, TUniquePtr<FRavenConcurrentPool>>& Pair : This->ConcurrentPools)
+	{
+		Pair.Value->AddReferencedObjects(Collector, This);
+	}
+}
+
 int32 URavenPoolSubsystem::GetPoolSize(UClass* ObjectClass) const
 {
 	const FRavenPool* Pool = GetPoolForClass(ObjectClass);
@@ -200,6 +1006,18 @@ int32 URavenPoolSubsystem::GetInactiveCount(UClass* ObjectClass) const
 	return Pool ? Pool->GetInactiveCount() : 0;
 }
 
+FRavenPoolStats URavenPoolSubsystem::GetPoolStats(UClass* ObjectClass) const
+{
+	const FRavenPool* Pool = GetPoolForClass(ObjectClass);
+	return Pool ? Pool->GetStats() : FRavenPoolStats();
+}
+
+TSharedPtr<const FRavenPoolCounters, ESPMode::ThreadSafe> URavenPoolSubsystem::GetPoolCounters(UClass* ObjectClass) const
+{
+	const FRavenPool* Pool = GetPoolForClass(ObjectClass);
+	return Pool ? TSharedPtr<const FRavenPoolCounters, ESPMode::ThreadSafe>(Pool->GetCounters()) : nullptr;
+}
+
 void URavenPoolSubsystem::ClearInactiveObjects(UClass* ObjectClass)
 {
 	if (FRavenPool* Pool = GetPool(ObjectClass))
@@ -208,25 +1026,85 @@ void URavenPoolSubsystem::ClearInactiveObjects(UClass* ObjectClass)
 	}
 }
 
+void URavenPoolSubsystem::RecordUsage()
+{
+	const int32 Window = FMath::FloorToInt32(GetWorld()->GetTimeSeconds() / RecordedUsage.SampleInterval);
+
+	// Pools are never removed before the world ends, so class entries line up with pool ids
+	while (RecordedUsage.Classes.Num() < Pools.Num())
+	{
+		const FRavenPool* Pool = Pools[RecordedUsage.Classes.Num()].Get();
+		RecordedUsage.Classes.AddDefaulted_GetRef().Class = FSoftClassPath(Pool ? Pool->GetObjectClass() : nullptr);
+	}
+
+	for (int32 PoolId = 0; PoolId < Pools.Num(); ++PoolId)
+	{
+		if (!Pools[PoolId].IsValid())
+		{
+			continue;
+		}
+
+		FRavenPoolClassUsage& Usage = RecordedUsage.Classes[PoolId];
+		const int32 ActiveCount = Pools[PoolId]->GetActiveCount();
+		Usage.PeakActive = FMath::Max(Usage.PeakActive, ActiveCount);
+
+		if (Usage.ActiveCurve.Num() <= Window)
+		{
+			Usage.ActiveCurve.SetNumZeroed(Window + 1);
+		}
+		Usage.ActiveCurve[Window] = FMath::Max(Usage.ActiveCurve[Window], ActiveCount);
+	}
+}
+
+bool URavenPoolSubsystem::SaveUsageProfile()
+{
+	if (!bRecordingUsage)
+	{
+		UE_LOG(LogRavenPoolSubsystem, Error, TEXT("Cannot save pool usage: recording is disabled in the pool developer settings"));
+		return false;
+	}
+
+	RecordUsage();
+
+	FRavenPoolUsageProfile Run = RecordedUsage;
+	for (int32 PoolId = 0; PoolId < Run.Classes.Num(); ++PoolId)
+	{
+		Run.Classes[PoolId].Acquisitions = Pools[PoolId].IsValid() ? Pools[PoolId]->GetCounters()->GetTotalAcquisitions() : 0;
+	}
+	Run.Classes.RemoveAll([](const FRavenPoolClassUsage& Usage) { return Usage.Class.IsNull(); });
+
+	const FString Filename = FRavenPoolUsageProfile::GetRunDirectory() / FString::Printf(TEXT("%s-%s.json"),
+		*FPackageName::GetShortName(Run.Map), *FDateTime::Now().ToString());
+	if (!Run.SaveToFile(Filename))
+	{
+		return false;
+	}
+
+	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Saved pool usage of %d classes to %s"), Run.Classes.Num(), *Filename);
+	return true;
+}
+
 void URavenPoolSubsystem::LogPoolStatistics() const
 {
 	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("=== Pool Statistics ==="));
 	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("Total Pools: %d"), Pools.Num());
 
-	for (const FRavenPool& Pool : Pools)
+	for (const TUniquePtr<FRavenPool>& PoolPtr : Pools)
 	{
-		const int32 ActiveCount = Pool.GetActiveCount();
-		const int32 InactiveCount = Pool.GetInactiveCount();
-		const int32 TotalCount = Pool.GetPoolSize();
-		const float UsagePercent = TotalCount > 0 ? (static_cast<float>(ActiveCount) / TotalCount) * 100.0f : 0.0f;
+		const FRavenPool& Pool = *PoolPtr;
+		const FRavenPoolStats Stats = Pool.GetStats();
 
-		UE_LOG(LogRavenPoolSubsystem, Log, TEXT("  [%s] Total: %d | Active: %d | Inactive: %d | Usage: %.1f%% | Max: %s"),
+		UE_LOG(LogRavenPoolSubsystem, Log, TEXT("  [%s] Total: %d | Active: %d | Inactive: %d | Usage: %.1f%% | Max: %s | Peak: %d | Acquired: %lld | Reused: %lld | Created on acquire: %lld"),
 		       Pool.GetObjectClass() ? *Pool.GetObjectClass()->GetName() : TEXT("Unknown"),
-		       TotalCount,
-		       ActiveCount,
-		       InactiveCount,
-		       UsagePercent,
-		       Pool.GetMaxPoolSize() > 0 ? *FString::FromInt(Pool.GetMaxPoolSize()) : TEXT("Unlimited"));
+		       Stats.TotalCount,
+		       Stats.ActiveCount,
+		       Stats.InactiveCount,
+		       Stats.UsagePercent,
+		       Pool.GetMaxPoolSize() > 0 ? *FString::FromInt(Pool.GetMaxPoolSize()) : TEXT("Unlimited"),
+		       Stats.PeakPoolSize,
+		       Stats.TotalAcquisitions,
+		       Stats.TotalReuses,
+		       Stats.TotalSynchronousCreations);
 	}
 
 	UE_LOG(LogRavenPoolSubsystem, Log, TEXT("====================="));
@@ -0,0 +1,67 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenPoolTimingWheel.h"
+
+FRavenPoolTimingWheel::FRavenPoolTimingWheel(const double InResolution, const int32 InNumBuckets)
+	: Resolution(FMath::Max(InResolution, UE_KINDA_SMALL_NUMBER))
+{
+	const int32 NumBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(InNumBuckets, 1));
+	Buckets.SetNum(NumBuckets);
+	BucketMask = NumBuckets - 1;
+}
+
+void FRavenPoolTimingWheel::Schedule(const FRavenPoolSlotId& SlotId, const double ExpiryTime)
+{
+	// Timers that are already due go into the next tick so the current Advance never misses them
+	const int64 ExpiryTick = FMath::Max(static_cast<int64>(FMath::CeilToDouble(ExpiryTime / Resolution)), CurrentTick + 1);
+
+	FTimer Timer;
+	Timer.SlotId = SlotId;
+	Timer.ExpiryTick = ExpiryTick;
+	Buckets[ExpiryTick & BucketMask].Add(Timer);
+	NumTimers++;
+}
+
+void FRavenPoolTimingWheel::Advance(const double CurrentTime, TArray<FRavenPoolSlotId>& OutExpired)
+{
+	const int64 TargetTick = static_cast<int64>(FMath::FloorToDouble(CurrentTime / Resolution));
+	if (TargetTick <= CurrentTick)
+	{
+		return;
+	}
+
+	if (NumTimers > 0)
+	{
+		// After a full turn every bucket has been visited, so long frames never cost more than one rotation
+		const int64 NumTicks = FMath::Min<int64>(TargetTick - CurrentTick, Buckets.Num());
+		for (int64 Tick = TargetTick - NumTicks + 1; Tick <= TargetTick; ++Tick)
+		{
+			ExpireBucket(Buckets[Tick & BucketMask], TargetTick, OutExpired);
+		}
+	}
+
+	CurrentTick = TargetTick;
+}
+
+void FRavenPoolTimingWheel::Reset()
+{
+	for (TArray<FTimer>& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+	NumTimers = 0;
+}
+
+void FRavenPoolTimingWheel::ExpireBucket(TArray<FTimer>& Bucket, const int64 UpToTick, TArray<FRavenPoolSlotId>& OutExpired)
+{
+	// Timers of later turns share the bucket and stay in it
+	for (int32 Index = Bucket.Num() - 1; Index >= 0; --Index)
+	{
+		if (Bucket[Index].ExpiryTick <= UpToTick)
+		{
+			OutExpired.Add(Bucket[Index].SlotId);
+			Bucket.RemoveAtSwap(Index, EAllowShrinking::No);
+			NumTimers--;
+		}
+	}
+}
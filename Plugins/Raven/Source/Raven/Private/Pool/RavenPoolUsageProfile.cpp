@@ -0,0 +1,110 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenPoolUsageProfile.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRavenPoolUsageProfile, Log, All);
+
+const FRavenPoolClassUsage* FRavenPoolUsageProfile::FindClass(const FSoftObjectPath& Class) const
+{
+	return Classes.FindByPredicate([&Class](const FRavenPoolClassUsage& Entry) { return Entry.Class == Class; });
+}
+
+FRavenPoolClassUsage& FRavenPoolUsageProfile::FindOrAddClass(const FSoftClassPath& Class)
+{
+	if (FRavenPoolClassUsage* Usage = Classes.FindByPredicate([&Class](const FRavenPoolClassUsage& Entry) { return Entry.Class == Class; }))
+	{
+		return *Usage;
+	}
+
+	FRavenPoolClassUsage& Usage = Classes.AddDefaulted_GetRef();
+	Usage.Class = Class;
+	return Usage;
+}
+
+bool FRavenPoolUsageProfile::Merge(const FRavenPoolUsageProfile& Other)
+{
+	if (Other.Map != Map)
+	{
+		UE_LOG(LogRavenPoolUsageProfile, Warning, TEXT("Skipping pool usage profile of %s, it doesn't belong to %s"), *Other.Map, *Map);
+		return false;
+	}
+
+	// Runs recorded with another UsageProfileSampleInterval have curves of a different resolution
+	if (Other.SampleInterval != SampleInterval)
+	{
+		UE_LOG(LogRavenPoolUsageProfile, Warning, TEXT("Skipping pool usage profile of %s sampled every %.1fs, the merged profile is sampled every %.1fs"),
+			*Map, Other.SampleInterval, SampleInterval);
+		return false;
+	}
+
+	NumRuns += Other.NumRuns;
+
+	for (const FRavenPoolClassUsage& OtherUsage : Other.Classes)
+	{
+		FRavenPoolClassUsage& Usage = FindOrAddClass(OtherUsage.Class);
+		Usage.PeakActive = FMath::Max(Usage.PeakActive, OtherUsage.PeakActive);
+		Usage.Acquisitions += OtherUsage.Acquisitions;
+
+		if (Usage.ActiveCurve.Num() < OtherUsage.ActiveCurve.Num())
+		{
+			Usage.ActiveCurve.SetNumZeroed(OtherUsage.ActiveCurve.Num());
+		}
+		for (int32 Window = 0; Window < OtherUsage.ActiveCurve.Num(); ++Window)
+		{
+			Usage.ActiveCurve[Window] = FMath::Max(Usage.ActiveCurve[Window], OtherUsage.ActiveCurve[Window]);
+		}
+	}
+
+	return true;
+}
+
+bool FRavenPoolUsageProfile::SaveToFile(const FString& Filename) const
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(*this, Json) || !FFileHelper::SaveStringToFile(Json, *Filename))
+	{
+		UE_LOG(LogRavenPoolUsageProfile, Error, TEXT("Failed to write pool usage profile %s"), *Filename);
+		return false;
+	}
+
+	return true;
+}
+
+bool FRavenPoolUsageProfile::LoadFromFile(const FString& Filename, FRavenPoolUsageProfile& OutProfile)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Filename))
+	{
+		return false;
+	}
+
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutProfile))
+	{
+		UE_LOG(LogRavenPoolUsageProfile, Error, TEXT("Failed to parse pool usage profile %s"), *Filename);
+		return false;
+	}
+
+	return true;
+}
+
+FString FRavenPoolUsageProfile::GetRunDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("RavenPool/Runs");
+}
+
+FString FRavenPoolUsageProfile::GetProfileDirectory()
+{
+	return FPaths::ProjectContentDir() / TEXT("RavenPool/Profiles");
+}
+
+FString FRavenPoolUsageProfile::GetProfileFilename(const FString& Map)
+{
+	// "/Game/Maps/Arena" becomes "Game.Maps.Arena.json"
+	FString Name = Map;
+	Name.RemoveFromStart(TEXT("/"));
+	Name.ReplaceCharInline(TEXT('/'), TEXT('.'));
+	return GetProfileDirectory() / Name + TEXT(".json");
+}
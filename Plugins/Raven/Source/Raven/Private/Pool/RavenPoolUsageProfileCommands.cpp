@@ -0,0 +1,139 @@
+// RavenStorm Copyright @ 2025-2025
+
+#include "Pool/RavenPoolUsageProfile.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Pool/RavenPoolDeveloperSettings.h"
+#include "Pool/RavenPoolSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRavenPoolUsageProfileCommands, Log, All);
+
+namespace RavenPoolUsageProfileCommands
+{
+	void SaveUsageProfile(UWorld* World)
+	{
+		URavenPoolSubsystem* Subsystem = World ? World->GetSubsystem<URavenPoolSubsystem>() : nullptr;
+		if (!Subsystem)
+		{
+			UE_LOG(LogRavenPoolUsageProfileCommands, Error, TEXT("Raven.Pool.SaveUsageProfile needs a game world"));
+			return;
+		}
+
+		Subsystem->SaveUsageProfile();
+	}
+
+	FAutoConsoleCommandWithWorld SaveCommand(
+		TEXT("Raven.Pool.SaveUsageProfile"),
+		TEXT("Writes the pool usage recorded so far in the current world to Saved/RavenPool/Runs"),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&SaveUsageProfile));
+
+#if WITH_EDITOR
+	/**
+	 * Compares the merged profiles with the configured pools and logs the changes to the RavenPool config
+	 * they suggest.
+	 */
+	void SuggestConfigUpdates(const TMap<FString, FRavenPoolUsageProfile>& Profiles)
+	{
+		for (const FRavenPoolConfig& PoolConfig : GetDefault<URavenPoolDeveloperSettings>()->GetPoolConfigs())
+		{
+			const FSoftObjectPath ClassPath = PoolConfig.Class.ToSoftObjectPath();
+
+			int32 PeakActive = 0;
+			TArray<FString> UsedOnMaps;
+			for (const TTuple<FString, FRavenPoolUsageProfile>& Pair : Profiles)
+			{
+				const FRavenPoolClassUsage* Usage = Pair.Value.FindClass(ClassPath);
+				if (Usage && Usage->PeakActive > 0)
+				{
+					PeakActive = FMath::Max(PeakActive, Usage->PeakActive);
+					UsedOnMaps.Add(Pair.Key);
+				}
+			}
+
+			if (UsedOnMaps.IsEmpty())
+			{
+				UE_LOG(LogRavenPoolUsageProfileCommands, Display, TEXT("%s: never acquired in the merged runs"), *ClassPath.ToString());
+				continue;
+			}
+
+			// Maps with a profile pre-warm from it, the configured size only covers the others
+			if (PoolConfig.InitialPoolSize != PeakActive)
+			{
+				UE_LOG(LogRavenPoolUsageProfileCommands, Display, TEXT("%s: suggest InitialPoolSize=%d (currently %d), the highest peak of %d maps"),
+					*ClassPath.ToString(), PeakActive, PoolConfig.InitialPoolSize, UsedOnMaps.Num());
+			}
+
+			if (PoolConfig.MaxPoolSize > 0 && PeakActive >= PoolConfig.MaxPoolSize)
+			{
+				UE_LOG(LogRavenPoolUsageProfileCommands, Warning, TEXT("%s: peak of %d active objects reached MaxPoolSize=%d, consider raising it"),
+					*ClassPath.ToString(), PeakActive, PoolConfig.MaxPoolSize);
+			}
+
+			if (PoolConfig.Maps.IsEmpty() && UsedOnMaps.Num() < Profiles.Num())
+			{
+				UE_LOG(LogRavenPoolUsageProfileCommands, Display, TEXT("%s: only used on %s, suggest listing them in Maps"),
+					*ClassPath.ToString(), *FString::Join(UsedOnMaps, TEXT(", ")));
+			}
+		}
+	}
+
+	/**
+	 * Merges every recorded run of a directory into the per-map profiles the pool subsystem pre-warms from,
+	 * then suggests config updates.
+	 */
+	void MergeUsageProfiles(const TArray<FString>& Args)
+	{
+		const FString RunDirectory = Args.IsEmpty() ? FRavenPoolUsageProfile::GetRunDirectory() : Args[0];
+
+		TArray<FString> RunFiles;
+		IFileManager::Get().FindFiles(RunFiles, *(RunDirectory / TEXT("*.json")), true, false);
+
+		TMap<FString, FRavenPoolUsageProfile> Profiles;
+		for (const FString& RunFile : RunFiles)
+		{
+			FRavenPoolUsageProfile Run;
+			if (!FRavenPoolUsageProfile::LoadFromFile(RunDirectory / RunFile, Run) || Run.Map.IsEmpty())
+			{
+				continue;
+			}
+
+			if (FRavenPoolUsageProfile* Profile = Profiles.Find(Run.Map))
+			{
+				Profile->Merge(Run);
+			}
+			else
+			{
+				Profiles.Add(Run.Map, MoveTemp(Run));
+			}
+		}
+
+		if (Profiles.IsEmpty())
+		{
+			UE_LOG(LogRavenPoolUsageProfileCommands, Warning, TEXT("No pool usage runs found in %s"), *RunDirectory);
+			return;
+		}
+
+		for (const TTuple<FString, FRavenPoolUsageProfile>& Pair : Profiles)
+		{
+			const FString Filename = FRavenPoolUsageProfile::GetProfileFilename(Pair.Key);
+			if (Pair.Value.SaveToFile(Filename))
+			{
+				UE_LOG(LogRavenPoolUsageProfileCommands, Display, TEXT("Merged %d runs of %s into %s"), Pair.Value.NumRuns, *Pair.Key, *Filename);
+			}
+		}
+
+		SuggestConfigUpdates(Profiles);
+	}
+
+	FAutoConsoleCommand MergeCommand(
+		TEXT("Raven.Pool.MergeUsageProfiles"),
+		TEXT("Merges recorded pool usage runs into per-map profiles and suggests RavenPool config updates. Usage: Raven.Pool.MergeUsageProfiles [RunDirectory]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&MergeUsageProfiles));
+#endif
+}
+
+#endif
@@ -3,57 +3,214 @@
 #include "Pool/Strategy/RavenPoolStrategy.h"
 #include "Pool/RavenPool.h"
 
-int32 FRavenPoolFIFOStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices)
+int32 FRavenPoolFIFOStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList)
 {
-	// Return the first inactive object (oldest)
-	return InactiveIndices.Num() > 0 ? InactiveIndices[0] : INDEX_NONE;
+	return FRavenPoolFIFOSelector::Select(FreeList);
 }
 
-int32 FRavenPoolLIFOStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices)
+int32 FRavenPoolLIFOStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList)
 {
-	// Return the last inactive object (most recently released)
-	return InactiveIndices.Num() > 0 ? InactiveIndices.Last() : INDEX_NONE;
+	return FRavenPoolLIFOSelector::Select(FreeList);
 }
 
-int32 FRavenPoolLRUStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices)
+int32 FRavenPoolLRUStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList)
 {
-	if (InactiveIndices.Num() == 0)
+	// The oldest released object is the one used the longest time ago
+	return FRavenPoolFIFOSelector::Select(FreeList);
+}
+
+int32 FRavenPoolRandomStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList)
+{
+	return FRavenPoolRandomSelector::Select(FreeList);
+}
+
+FRavenPoolNearestStrategy::FRavenPoolNearestStrategy(const float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+int32 FRavenPoolNearestStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList)
+{
+	return FRavenPoolFIFOSelector::Select(FreeList);
+}
+
+int32 FRavenPoolNearestStrategy::FindInactiveObjectNear(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList, const FVector& Location)
+{
+	if (FreeList.IsEmpty())
 	{
 		return INDEX_NONE;
 	}
 
-	// Find the inactive object with the oldest last used time
-	int32 OldestIndex = InactiveIndices[0];
-	double OldestTime = Pool[OldestIndex].LastUsedTime;
+	const FIntVector Center = GetCell(Location);
+	int32 BestIndex = INDEX_NONE;
+	double BestDistanceSquared = TNumericLimits<double>::Max();
+	int32 NumCellsVisited = 0;
+
+	// Search shells of cells of growing radius around the requested location
+	for (int32 Radius = 0; Radius <= MaxSearchRadius; ++Radius)
+	{
+		// Once the shell would probe more cells than are left, looking at every occupied cell is cheaper and exact
+		const int32 ShellSize = Radius == 0 ? 1 : FMath::Cube(2 * Radius + 1) - FMath::Cube(2 * Radius - 1);
+		if (Cells.Num() - NumCellsVisited < ShellSize)
+		{
+			for (const TTuple<FIntVector, int32>& Pair : Cells)
+			{
+				FindNearestInCell(Pair.Value, Location, BestIndex, BestDistanceSquared);
+			}
+			return BestIndex;
+		}
+
+		for (int32 X = -Radius; X <= Radius; ++X)
+		{
+			for (int32 Y = -Radius; Y <= Radius; ++Y)
+			{
+				// Inside the shell only the two cells at Z = +-Radius are new, the rest was visited at smaller radii
+				const bool bOnShell = FMath::Abs(X) == Radius || FMath::Abs(Y) == Radius;
+				const int32 StepZ = bOnShell ? 1 : FMath::Max(2 * Radius, 1);
+				for (int32 Z = -Radius; Z <= Radius; Z += StepZ)
+				{
+					if (const int32* FirstIndex = Cells.Find(Center + FIntVector(X, Y, Z)))
+					{
+						FindNearestInCell(*FirstIndex, Location, BestIndex, BestDistanceSquared);
+						NumCellsVisited++;
+					}
+				}
+			}
+		}
+
+		// Every inactive object has been looked at
+		if (NumCellsVisited == Cells.Num())
+		{
+			return BestIndex;
+		}
+
+		// Anything in the next shell is at least Radius cells away
+		if (BestIndex != INDEX_NONE && BestDistanceSquared <= FMath::Square(Radius * static_cast<double>(CellSize)))
+		{
+			return BestIndex;
+		}
+	}
+
+	// Nothing close by, any inactive object will do
+	return BestIndex != INDEX_NONE ? BestIndex : FreeList.GetOldest();
+}
 
-	for (int32 i = 1; i < InactiveIndices.Num(); ++i)
+void FRavenPoolNearestStrategy::FindNearestInCell(const int32 FirstIndex, const FVector& Location, int32& InOutBestIndex, double& InOutBestDistanceSquared) const
+{
+	for (int32 Index = FirstIndex; Index != INDEX_NONE; Index = Slots[Index].NextInCell)
 	{
-		const int32 Index = InactiveIndices[i];
-		if (Pool[Index].LastUsedTime < OldestTime)
+		const double DistanceSquared = FVector::DistSquared(Slots[Index].Location, Location);
+		if (DistanceSquared < InOutBestDistanceSquared)
 		{
-			OldestTime = Pool[Index].LastUsedTime;
-			OldestIndex = Index;
+			InOutBestDistanceSquared = DistanceSquared;
+			InOutBestIndex = Index;
 		}
 	}
+}
+
+void FRavenPoolNearestStrategy::Reserve(const int32 Capacity)
+{
+	Slots.Reserve(Capacity);
 
-	return OldestIndex;
+	// Every non-empty cell holds at least one inactive slot
+	Cells.Reserve(Capacity);
 }
 
-int32 FRavenPoolRandomStrategy::FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices)
+void FRavenPoolNearestStrategy::SetObjectLocation(const int32 Index, const FVector& Location)
 {
-	if (InactiveIndices.Num() == 0)
+	if (Index >= Slots.Num())
 	{
-		return INDEX_NONE;
+		Slots.SetNum(Index + 1);
+	}
+
+	Unlink(Index);
+	Slots[Index].Location = Location;
+}
+
+void FRavenPoolNearestStrategy::OnObjectAcquired(const int32 Index)
+{
+	Unlink(Index);
+}
+
+void FRavenPoolNearestStrategy::OnObjectReleased(const int32 Index)
+{
+	if (Index >= Slots.Num())
+	{
+		Slots.SetNum(Index + 1);
+	}
+
+	Unlink(Index);
+
+	FStoredSlot& Slot = Slots[Index];
+	Slot.Cell = GetCell(Slot.Location);
+	Slot.PrevInCell = INDEX_NONE;
+	Slot.bStored = true;
+
+	// Push to the front of the cell's list
+	int32& FirstIndex = Cells.FindOrAdd(Slot.Cell, INDEX_NONE);
+	Slot.NextInCell = FirstIndex;
+	if (FirstIndex != INDEX_NONE)
+	{
+		Slots[FirstIndex].PrevInCell = Index;
+	}
+	FirstIndex = Index;
+}
+
+void FRavenPoolNearestStrategy::OnObjectRemoved(const int32 Index)
+{
+	Unlink(Index);
+}
+
+FIntVector FRavenPoolNearestStrategy::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void FRavenPoolNearestStrategy::Unlink(const int32 Index)
+{
+	if (!Slots.IsValidIndex(Index) || !Slots[Index].bStored)
+	{
+		return;
+	}
+
+	FStoredSlot& Slot = Slots[Index];
+	if (Slot.PrevInCell != INDEX_NONE)
+	{
+		Slots[Slot.PrevInCell].NextInCell = Slot.NextInCell;
+	}
+	else if (Slot.NextInCell != INDEX_NONE)
+	{
+		Cells.FindChecked(Slot.Cell) = Slot.NextInCell;
+	}
+	else
+	{
+		// Only cells holding inactive slots exist; the map keeps its memory for the next cell
+		Cells.Remove(Slot.Cell);
+	}
+
+	if (Slot.NextInCell != INDEX_NONE)
+	{
+		Slots[Slot.NextInCell].PrevInCell = Slot.PrevInCell;
 	}
 
-	// Select a random inactive object
-	const int32 RandomIndex = FMath::RandRange(0, InactiveIndices.Num() - 1);
-	return InactiveIndices[RandomIndex];
+	Slot.PrevInCell = INDEX_NONE;
+	Slot.NextInCell = INDEX_NONE;
+	Slot.bStored = false;
 }
 
 TSharedPtr<IRavenPoolAcquisitionStrategy> FRavenPoolStrategyFactory::CreateStrategy(ERavenPoolAcquisitionStrategy StrategyType)
 {
-	switch (StrategyType)
+	FRavenPoolPolicy Policy;
+	Policy.AcquisitionStrategy = StrategyType;
+	return CreateStrategy(Policy);
+}
+
+TSharedPtr<IRavenPoolAcquisitionStrategy> FRavenPoolStrategyFactory::CreateStrategy(const FRavenPoolPolicy& Policy)
+{
+	switch (Policy.AcquisitionStrategy)
 	{
 	case ERavenPoolAcquisitionStrategy::FIFO:
 		return MakeShared<FRavenPoolFIFOStrategy>();
@@ -67,6 +224,9 @@ TSharedPtr<IRavenPoolAcquisitionStrategy> FRavenPoolStrategyFactory::CreateStrat
 	case ERavenPoolAcquisitionStrategy::Random:
 		return MakeShared<FRavenPoolRandomStrategy>();
 
+	case ERavenPoolAcquisitionStrategy::Nearest:
+		return MakeShared<FRavenPoolNearestStrategy>(Policy.SpatialHashCellSize);
+
 	default:
 		return MakeShared<FRavenPoolFIFOStrategy>();
 	}
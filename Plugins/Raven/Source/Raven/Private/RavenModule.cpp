@@ -3,12 +3,17 @@
 #include "RavenModule.h"
 
 #include "RavenGlobals.h"
+#include "Pool/RavenPoolAllocationCheck.h"
 
 #define LOCTEXT_NAMESPACE "FRavenModule"
 
 void FRavenModule::StartupModule()
 {
 	UE_LOGFMT(LogRaven, Log, "Raven Module loaded");
+
+#if RAVEN_POOL_ALLOCATION_CHECKS
+	FRavenPoolNoAllocationScope::InstallIfRequested();
+#endif
 }
 
 void FRavenModule::ShutdownModule()
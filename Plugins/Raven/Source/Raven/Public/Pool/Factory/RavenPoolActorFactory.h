@@ -6,6 +6,19 @@
 #include "RavenPoolFactoryUObject.h"
 #include "RavenPoolActorFactory.generated.h"
 
+/**
+ * Where pooled actors are kept while they are inactive.
+ */
+UENUM(BlueprintType)
+enum class ERavenPoolActorStorageMode : uint8
+{
+	/** Actors are moved to the factory's storage location */
+	StorageLocation UMETA(DisplayName = "Storage Location"),
+
+	/** Actors stay hidden where they were released, so the Nearest acquisition strategy can reuse them nearby */
+	InPlace UMETA(DisplayName = "In Place")
+};
+
 /**
  * Factory for creating and managing pooled actors.
  * Handles actor-specific operations like spawning, destruction, and state management.
@@ -21,7 +34,7 @@ public:
 	virtual void DestroyPoolObject_Implementation(UObject* Object) override;
 
 	/**
-	 * Prepares an actor for storage by moving it out of view and disabling it.
+	 * Prepares an actor for storage by moving it out of view (unless stored in place) and disabling it.
 	 * Disables tick, collision, and visibility.
 	 */
 	virtual void PrepareForStorage_Implementation(UObject* Object) override;
@@ -36,8 +49,12 @@ public:
 	virtual bool CanCreateClass_Implementation(UClass* Class) const override;
 
 protected:
-	/** Location to move actors to when stored in the pool */
+	/** Where actors are kept while stored in the pool */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Pool")
+	ERavenPoolActorStorageMode StorageMode = ERavenPoolActorStorageMode::StorageLocation;
+
+	/** Location to move actors to when stored in the pool */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Pool", meta = (EditCondition = "StorageMode == ERavenPoolActorStorageMode::StorageLocation"))
 	FVector StorageLocation = FVector(0.0f, 0.0f, -10000.0f);
 
 	/** Whether to disable components when storing actors */
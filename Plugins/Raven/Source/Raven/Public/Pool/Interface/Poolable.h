@@ -37,6 +37,15 @@ public:
 	void OnReturnedToPool();
 	virtual void OnReturnedToPool_Implementation() {}
 
+	/**
+	 * Called when the pool takes the object back from its user to hand it to someone else, because the pool was
+	 * full and recycles its oldest active object. Called before OnReturnedToPool.
+	 * Use this to tell the object's user it no longer owns the object.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Raven|Pool")
+	void OnReclaimedByPool();
+	virtual void OnReclaimedByPool_Implementation() {}
+
 	/**
 	 * Checks if the object is valid for reuse.
 	 * If this returns false, the pool will destroy the object instead of reusing it.
@@ -0,0 +1,146 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LockFreeList.h"
+#include "HAL/CriticalSection.h"
+
+#include <atomic>
+
+class URavenPoolFactoryUObject;
+
+/**
+ * Pool of plain UObjects (no actors) that worker threads can acquire from and release to concurrently.
+ * Built like a slab allocator's magazine layer: every thread caches two magazines of objects and only goes to
+ * the shared depot of full and empty magazines, a pair of lock-free lists, when both are exhausted. In the
+ * common case acquire and release touch thread-local state only.
+ *
+ * Objects are only ever created on the game thread, by PreWarm or by Tick after workers ran dry; Acquire
+ * returns nullptr instead of creating. Objects are handed out as they were released: no factory preparation
+ * and no IPoolable hooks are called, since neither is safe off the game thread.
+ * The pool must outlive every thread using it.
+ */
+class RAVEN_API FRavenConcurrentPool : public FNoncopyable
+{
+public:
+	/** Number of objects per magazine */
+	static constexpr int32 MagazineSize = 32;
+
+	FRavenConcurrentPool(UClass* InObjectClass, URavenPoolFactoryUObject* InFactory);
+	~FRavenConcurrentPool();
+
+	/**
+	 * Acquires an object. Safe to call from any thread.
+	 * @return The acquired object, or nullptr if the pool ran dry (it grows on the next Tick)
+	 */
+	UObject* Acquire();
+
+	/**
+	 * Releases an object acquired from this pool. Safe to call from any thread.
+	 * @param Object The object to release
+	 */
+	void Release(UObject* Object);
+
+	/**
+	 * Creates objects and stocks the depot with them. Game thread only.
+	 * @param Count The number of objects to create, rounded up to whole magazines; a pool reaching its max size
+	 * fills a last partial magazine instead
+	 * @return The number of objects created
+	 */
+	int32 PreWarm(int32 Count);
+
+	/**
+	 * Grows the pool by a magazine if any thread ran dry since the last tick. Game thread only.
+	 */
+	void Tick();
+
+	/**
+	 * Sets the maximum number of objects the pool may create (0 = unlimited). Game thread only.
+	 * @param InMaxPoolSize The new maximum
+	 */
+	void SetMaxPoolSize(const int32 InMaxPoolSize) { MaxPoolSize = InMaxPoolSize; }
+
+	/** Gets the number of objects created by the pool. Game thread only. */
+	int32 GetPoolSize() const { return AllObjects.Num(); }
+
+	/** Gets every object created by the pool, wherever it currently is. Game thread only. */
+	TConstArrayView<TObjectPtr<UObject>> GetAllObjects() const { return AllObjects; }
+
+	/** Gets the number of acquisitions that found the pool empty since the pool was created */
+	int64 GetTotalMisses() const { return TotalMisses.load(std::memory_order_relaxed); }
+
+	/** Gets the pooled class */
+	UClass* GetObjectClass() const { return ObjectClass; }
+
+	/**
+	 * Reports the pool's objects, class and factory to the garbage collector.
+	 * @param Collector The reference collector
+	 * @param ReferencingObject The object owning the pool
+	 */
+	void AddReferencedObjects(FReferenceCollector& Collector, const UObject* ReferencingObject);
+
+private:
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FMagazine
+	{
+		UObject* Objects[MagazineSize];
+		int32 Num = 0;
+	};
+
+	/** A thread's magazines. The previous magazine is always either full or empty. */
+	struct FThreadCache
+	{
+		FMagazine* Loaded = nullptr;
+		FMagazine* Previous = nullptr;
+	};
+
+	/** Gets the calling thread's cache, creating it on first use */
+	FThreadCache& GetThreadCache()
+	{
+		FThreadCache* Cache = static_cast<FThreadCache*>(FPlatformTLS::GetTlsValue(TlsSlot));
+		return LIKELY(Cache) ? *Cache : CreateThreadCache();
+	}
+
+	/** Creates and registers the calling thread's cache */
+	FThreadCache& CreateThreadCache();
+
+	/** Takes an empty magazine from the depot, allocating one if there is none */
+	FMagazine* PopEmptyMagazine();
+
+private:
+	/** Magazines filled with available objects */
+	TLockFreePointerListUnordered<FMagazine, PLATFORM_CACHE_LINE_SIZE> FullMagazines;
+
+	/** Magazines with no objects in them */
+	TLockFreePointerListUnordered<FMagazine, PLATFORM_CACHE_LINE_SIZE> EmptyMagazines;
+
+	/** Acquisitions that found the pool empty since the last tick */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int32> PendingMisses{0};
+
+	/** Acquisitions that found the pool empty since the pool was created */
+	std::atomic<int64> TotalMisses{0};
+
+	/** TLS slot holding each thread's FThreadCache */
+	uint32 TlsSlot = FPlatformTLS::InvalidTlsSlot;
+
+	/** Guards the ownership lists below, which are only touched on slow paths */
+	FCriticalSection OwnershipLock;
+
+	/** Every thread cache created, deleted along with the pool */
+	TArray<TUniquePtr<FThreadCache>> ThreadCaches;
+
+	/** Every magazine allocated, deleted along with the pool */
+	TArray<TUniquePtr<FMagazine>> AllMagazines;
+
+	/** The pooled class */
+	TObjectPtr<UClass> ObjectClass;
+
+	/** Factory used to create the pooled objects */
+	TObjectPtr<URavenPoolFactoryUObject> Factory;
+
+	/** Every object created by the pool, keeping them alive wherever they are. Game thread only. */
+	TArray<TObjectPtr<UObject>> AllObjects;
+
+	/** Maximum number of objects the pool may create (0 = unlimited) */
+	int32 MaxPoolSize = 0;
+};
@@ -4,44 +4,101 @@
 
 #include "CoreMinimal.h"
 #include "Pool/RavenPoolTypes.h"
+#include "Pool/RavenPoolFreeList.h"
+#include "Pool/RavenPoolCounters.h"
+#include "Pool/RavenPoolHookDispatch.h"
+#include "UObject/ObjectKey.h"
 #include "RavenPool.generated.h"
 
 class URavenPoolFactoryUObject;
 class IRavenPoolAcquisitionStrategy;
 
+template <typename T, typename StrategyType, typename FactoryType>
+class TRavenTypedPool;
+
 /**
- * Represents a single entry in the object pool.
- * Tracks whether the object is currently active (in use) or inactive (available for reuse).
+ * Per-slot bookkeeping of the object pool that is not touched by the per-frame scans.
+ * The hot per-slot data (occupancy, activity, timestamps and object pointers) is kept by the pool
+ * in separate packed arrays. Slots never move; vacated slots are recycled through the pool's
+ * vacant slot list.
  */
 USTRUCT(BlueprintType)
 struct RAVEN_API FRavenPoolEntry
 {
 	GENERATED_BODY()
 
-	/** Whether this pooled object is currently active/in use */
+	/** Number of times this object has been acquired */
 	UPROPERTY()
-	bool bIsActive = false;
+	int32 AcquireCount = 0;
 
-	/** The pooled object instance */
-	UPROPERTY()
-	TObjectPtr<UObject> Object = nullptr;
+	/** Previous (older) entry in the pool's free list */
+	int32 FreePrev = INDEX_NONE;
 
-	/** Last time this object was used (for LRU strategy) */
-	UPROPERTY()
-	double LastUsedTime = 0.0;
+	/** Next (newer) entry in the pool's free list */
+	int32 FreeNext = INDEX_NONE;
 
-	/** Number of times this object has been acquired */
-	UPROPERTY()
-	int32 AcquireCount = 0;
+	/** Position of this entry in the free list's dense array (INDEX_NONE while active) */
+	int32 FreeSlot = INDEX_NONE;
 
-	/**
-	 * Validates that the object is still valid for use.
-	 * @return True if valid, false otherwise
-	 */
-	bool Validate() const;
+	/** Next slot in the pool's vacant slot list (only meaningful while unoccupied) */
+	int32 NextVacantSlot = INDEX_NONE;
 
-public:
-	friend RAVEN_API bool operator==(const FRavenPoolEntry& A, const UObject* B) { return A.Object == B; }
+	/** Incremented whenever the slot's object is released or removed, invalidating outstanding slot ids */
+	uint32 Generation = 0;
+
+	/** Owner list this active entry is linked into (INDEX_NONE if acquired without an owner) */
+	int32 OwnerList = INDEX_NONE;
+
+	/** Previous entry acquired for the same owner */
+	int32 OwnerPrev = INDEX_NONE;
+
+	/** Next entry acquired for the same owner */
+	int32 OwnerNext = INDEX_NONE;
+
+	/** Burst reservation holding this inactive entry (INDEX_NONE if it is on the free list or active) */
+	int32 Reservation = INDEX_NONE;
+
+	/** Previous (earlier acquired) active entry, only linked while the pool recycles on overflow */
+	int32 ActivePrev = INDEX_NONE;
+
+	/** Next (later acquired) active entry, only linked while the pool recycles on overflow */
+	int32 ActiveNext = INDEX_NONE;
+};
+
+/**
+ * Inactive entries set aside for one burst reservation, kept off the free list so no other acquisition takes them.
+ */
+struct FRavenPoolReservation
+{
+	/** The reserved entries, ready to be acquired. Reserved for the full count so acquiring never allocates. */
+	TArray<int32> Slots;
+
+	/** Number of entries still to be reserved, taken from the free list or created within the frame budget */
+	int32 NumPending = 0;
+
+	/** Platform time at which unused entries return to general use */
+	double ExpiryTime = 0.0;
+
+	/** Serial number matched against tickets */
+	uint32 Serial = 0;
+};
+
+/**
+ * Head of the intrusive list of active pool entries acquired for one owner.
+ */
+struct FRavenPoolOwnerList
+{
+	/** The owner, weakly referenced so the pool notices when it is garbage collected */
+	TWeakObjectPtr<const UObject> Owner;
+
+	/** Key of the owner in the pool's owner list map, still valid after the owner is gone */
+	FObjectKey OwnerKey;
+
+	/** First entry of the list */
+	int32 Head = INDEX_NONE;
+
+	/** Number of entries in the list */
+	int32 Num = 0;
 };
 
 /**
@@ -65,6 +122,71 @@ public:
 	 */
 	UObject* Acquire();
 
+	/**
+	 * Acquires an object from the pool and returns the id of the slot it occupies.
+	 * A full pool using the SpawnTransient overflow policy fails instead, since transient objects have no slot.
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* Acquire(FRavenPoolSlotId& OutSlotId);
+
+	/**
+	 * Acquires an object that is going to be used at the given location.
+	 * With the Nearest acquisition strategy, the inactive object released closest to it is reused;
+	 * other strategies ignore the location.
+	 * @param Location The location the object will be used at
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireNear(const FVector& Location);
+
+	/**
+	 * Acquires an object that is going to be used at the given location and returns its slot id.
+	 * Like Acquire with a slot id, never hands out a transient object.
+	 * @param Location The location the object will be used at
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireNear(const FVector& Location, FRavenPoolSlotId& OutSlotId);
+
+	/**
+	 * Acquires an object, places it at a transform and initializes it before it is prepared for usage.
+	 * Actors and scene components are teleported without sweeping while still hidden and without collision,
+	 * so the factory activates them in one step at their final location. Doubles as a location hint for the
+	 * Nearest acquisition strategy.
+	 * @param Transform The transform to place the object at
+	 * @param Initializer Called with the dormant object after placing it and before any acquisition hook
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireAt(const FTransform& Transform, TFunctionRef<void(UObject*)> Initializer);
+
+	/**
+	 * Acquires an object, places it at a transform and initializes it, and returns its slot id.
+	 * Like Acquire with a slot id, never hands out a transient object.
+	 * @param Transform The transform to place the object at
+	 * @param Initializer Called with the dormant object after placing it and before any acquisition hook
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireAt(const FTransform& Transform, TFunctionRef<void(UObject*)> Initializer, FRavenPoolSlotId& OutSlotId);
+
+	/**
+	 * Acquires a batch of objects from the pool.
+	 * Validity checks, timestamps and logging happen once per batch instead of once per object.
+	 * @param Count The number of objects to acquire
+	 * @param OutObjects Receives the acquired objects, appended to any existing elements
+	 * @return The number of objects acquired, which is less than Count if the pool is full or creation fails
+	 */
+	int32 AcquireMany(int32 Count, TArray<UObject*>& OutObjects);
+
+	/**
+	 * Acquires one object per transform and moves actors and scene components there (teleporting physics)
+	 * before their hooks are called. With the Nearest acquisition strategy each object is taken from near its transform.
+	 * @param Transforms The transforms to place the acquired objects at
+	 * @param OutObjects Receives the acquired objects, appended to any existing elements
+	 * @return The number of objects acquired, which is less than the number of transforms if the pool is full or creation fails
+	 */
+	int32 AcquireManyAtTransforms(TConstArrayView<FTransform> Transforms, TArray<UObject*>& OutObjects);
+
 	/**
 	 * Releases an object back to the pool for reuse.
 	 * @param Object The object to release
@@ -72,6 +194,110 @@ public:
 	 */
 	bool Release(UObject* Object);
 
+	/**
+	 * Releases the object in the given slot back to the pool without an object lookup.
+	 * @param SlotId The slot id returned on acquisition
+	 * @return True if the object was released, false if the id is stale or belongs to another pool
+	 */
+	bool Release(const FRavenPoolSlotId& SlotId);
+
+	/**
+	 * Releases a batch of objects back to the pool.
+	 * Objects that are invalid, inactive or don't belong to this pool are skipped.
+	 * @param InObjects The objects to release
+	 * @return The number of objects released
+	 */
+	int32 ReleaseMany(TConstArrayView<UObject*> InObjects);
+
+	/**
+	 * Releases a batch of slots back to the pool without object lookups.
+	 * Stale slot ids and ids of other pools are skipped silently.
+	 * @param SlotIds The slot ids returned on acquisition
+	 * @return The number of objects released
+	 */
+	int32 ReleaseMany(TConstArrayView<FRavenPoolSlotId> SlotIds);
+
+	/**
+	 * Acquires an object on behalf of an owner, so it can be returned with ReleaseAllForOwner.
+	 * Objects still out when their owner is garbage collected are returned during maintenance.
+	 * Like Acquire with a slot id, never hands out a transient object.
+	 * @param Owner The owner or scope to acquire for (nullptr to acquire without an owner)
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireForOwner(const UObject* Owner, FRavenPoolSlotId& OutSlotId);
+
+	/**
+	 * Releases every object acquired for an owner, in O(objects owned).
+	 * @param Owner The owner to release the objects of
+	 * @return The number of objects released
+	 */
+	int32 ReleaseAllForOwner(const UObject* Owner);
+
+	/**
+	 * Gets the number of objects currently acquired for an owner.
+	 * @param Owner The owner
+	 * @return The number of active objects acquired for the owner
+	 */
+	int32 GetOwnedCount(const UObject* Owner) const;
+
+	/**
+	 * Sets aside inactive objects for an upcoming burst. Objects are taken from the free list right away and
+	 * the rest are created by FillReservations within a frame budget. Acquiring through the ticket never
+	 * creates an object.
+	 * @param Count The number of objects to reserve
+	 * @param Timeout Seconds after which unused objects return to general use
+	 * @return The reservation ticket, unset if nothing could be reserved
+	 */
+	FRavenPoolReservationTicket ReserveBurst(int32 Count, float Timeout);
+
+	/**
+	 * Acquires one of the objects set aside by a reservation. Never creates an object.
+	 * @param Ticket The reservation ticket
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if the reservation expired, was used up or is still being filled
+	 */
+	UObject* AcquireReserved(const FRavenPoolReservationTicket& Ticket, FRavenPoolSlotId& OutSlotId);
+
+	/**
+	 * Returns the unused objects of a reservation to general use.
+	 * @param Ticket The reservation ticket
+	 */
+	void CancelReservation(const FRavenPoolReservationTicket& Ticket);
+
+	/**
+	 * Gets the number of objects of a reservation that are ready to be acquired.
+	 * @param Ticket The reservation ticket
+	 * @return The number of ready objects, or 0 if the reservation expired
+	 */
+	int32 GetReservedCount(const FRavenPoolReservationTicket& Ticket) const;
+
+	/**
+	 * Whether any reservation still waits for objects.
+	 */
+	bool HasPendingReservations() const { return NumPendingReservations > 0; }
+
+	/**
+	 * Fills pending reservations from the free list and by creating objects until the deadline.
+	 * At least one object is created per call, so a tight budget still makes progress.
+	 * @param Deadline Platform time at which to stop creating objects
+	 */
+	void FillReservations(double Deadline);
+
+	/**
+	 * Checks whether a slot id still refers to the acquisition it was handed out for.
+	 * @param SlotId The slot id to check
+	 * @return True if the slot is still active with the same generation
+	 */
+	bool IsValidSlotId(const FRavenPoolSlotId& SlotId) const;
+
+	/**
+	 * Resolves a slot id to its object.
+	 * @param SlotId The slot id to resolve
+	 * @return The object, or nullptr if the id is stale
+	 */
+	UObject* ResolveSlotId(const FRavenPoolSlotId& SlotId) const;
+
 	/**
 	 * Pre-warms the pool by creating a specified number of objects in advance.
 	 * @param Count The number of objects to pre-create
@@ -79,11 +305,50 @@ public:
 	void PreWarm(int32 Count);
 
 	/**
-	 * Pre-warms the pool asynchronously (not yet implemented - placeholder).
+	 * Queues objects to be pre-created over several frames by TickPreWarm, so pre-warming never blocks a frame
+	 * for longer than its budget. Calls add up while a pre-warm is in progress.
 	 * @param Count The number of objects to pre-create
-	 * @param Callback Called when pre-warming completes
+	 * @param Callback Called once every queued object has been created
+	 * @return The number of objects queued, limited by the max pool size
+	 */
+	int32 PreWarmAsync(int32 Count, TFunction<void()> Callback = nullptr);
+
+	/**
+	 * Creates queued pre-warm objects until the deadline. At least one object is created per call, so a tight
+	 * budget still makes progress.
+	 * Objects queued in the background by replenishment and adaptive sizing are created along with them.
+	 * @param Deadline Platform time at which to stop creating objects
+	 * @return The number of objects queued by PreWarmAsync dealt with, including ones that failed or no longer fit
+	 * the pool; background objects are not counted
+	 */
+	int32 TickPreWarm(double Deadline);
+
+	/**
+	 * Creates one inactive object the way pre-warming does, so the next acquisition reuses it instead of creating
+	 * one synchronously.
+	 * @return True if the object was created
+	 */
+	bool CreateInactiveObject();
+
+	/**
+	 * Whether objects queued by PreWarmAsync are still waiting to be created.
 	 */
-	void PreWarmAsync(int32 Count, TFunction<void()> Callback = nullptr);
+	bool IsPreWarming() const { return PreWarmRemaining > 0; }
+
+	/**
+	 * Whether the free objects, counting the ones still queued for pre-warming, dropped below the low watermark.
+	 */
+	bool NeedsReplenishment() const
+	{
+		return Policy.LowWatermark > 0 && FreeList.Num() + PreWarmRemaining < Policy.LowWatermark;
+	}
+
+	/**
+	 * Queues objects for pre-warming until the free objects reach the high watermark, so acquisitions keep
+	 * finding free objects instead of creating them synchronously. The objects are created by TickPreWarm.
+	 * @return The number of objects queued, limited by the max pool size
+	 */
+	int32 Replenish();
 
 	/**
 	 * Clears all inactive objects from the pool.
@@ -93,9 +358,16 @@ public:
 
 	/**
 	 * Performs periodic maintenance on the pool based on policy settings.
-	 * @param DeltaTime Time since last tick
+	 * Idle expiry only visits the objects that actually expired.
+	 * @param CurrentTime The current platform time in seconds
 	 */
-	void Tick(float DeltaTime);
+	void Tick(double CurrentTime);
+
+	/**
+	 * Gets the earliest time at which Tick has any work to do (a shrink or an idle object expiring).
+	 * @return The platform time in seconds, or the maximum double if no maintenance is scheduled
+	 */
+	double GetNextMaintenanceTime() const;
 
 	/**
 	 * Validates all pooled objects and removes invalid ones.
@@ -107,25 +379,38 @@ public:
 	 * Gets the total number of objects in the pool (active and inactive).
 	 * @return The pool size
 	 */
-	int32 GetPoolSize() const { return Pool.Num(); }
+	int32 GetPoolSize() const { return NumObjects; }
 
 	/**
 	 * Gets the number of active (in-use) objects in the pool.
 	 * @return The number of active objects
 	 */
-	int32 GetActiveCount() const;
+	int32 GetActiveCount() const { return Counters->GetActiveCount(); }
 
 	/**
 	 * Gets the number of inactive (available) objects in the pool.
 	 * @return The number of inactive objects
 	 */
-	int32 GetInactiveCount() const;
+	int32 GetInactiveCount() const { return Counters->GetInactiveCount(); }
+
+	/**
+	 * Whether an acquisition can reuse an object. Unlike the inactive count, objects held by reservations
+	 * don't count.
+	 */
+	bool HasFreeObject() const { return !FreeList.IsEmpty(); }
 
 	/**
 	 * Gets detailed statistics for this pool.
 	 * @return Pool statistics
 	 */
-	FRavenPoolStats GetStats() const;
+	FRavenPoolStats GetStats() const { return Counters->Snapshot(); }
+
+	/**
+	 * Gets the counters of this pool for reading from other threads.
+	 * The counters stay alive as long as the returned reference, even if the pool is destroyed.
+	 * @return The pool counters
+	 */
+	TSharedRef<const FRavenPoolCounters, ESPMode::ThreadSafe> GetCounters() const { return Counters; }
 
 	/**
 	 * Gets the class of objects managed by this pool.
@@ -133,6 +418,12 @@ public:
 	 */
 	UClass* GetObjectClass() const { return ObjectClass; }
 
+	/**
+	 * Gets the id assigned to this pool by its subsystem.
+	 * @return The pool id
+	 */
+	int32 GetPoolId() const { return PoolId; }
+
 	/**
 	 * Gets the maximum allowed pool size (0 = unlimited).
 	 * @return The maximum pool size
@@ -143,7 +434,13 @@ public:
 	 * Sets the maximum allowed pool size (0 = unlimited).
 	 * @param InMaxSize The new maximum pool size
 	 */
-	void SetMaxPoolSize(int32 InMaxSize) { MaxPoolSize = InMaxSize; }
+	void SetMaxPoolSize(int32 InMaxSize);
+
+	/**
+	 * Gets the size adaptive sizing currently keeps the pool at.
+	 * @return The target size, or 0 if adaptive sizing is disabled
+	 */
+	int32 GetAdaptiveTargetSize() const { return Policy.bAdaptiveSizing ? AdaptiveTargetSize : 0; }
 
 	/**
 	 * Gets the pool policy configuration.
@@ -158,27 +455,253 @@ public:
 	void SetPolicy(const FRavenPoolPolicy& InPolicy);
 
 private:
+	/**
+	 * Acquires an object, optionally near a location.
+	 * @param Location The location the object will be used at, or nullptr if unknown
+	 * @param PrepareDormant Called with the object before it is prepared for usage
+	 * @param OutSlotId Receives the slot id of the acquired object, left unset for transient objects
+	 * @param bAllowTransient Whether a full pool may hand out a transient object under the SpawnTransient policy,
+	 * only for callers that don't need the slot id
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireInternal(const FVector* Location, TFunctionRef<void(UObject*)> PrepareDormant, FRavenPoolSlotId& OutSlotId,
+	                         bool bAllowTransient);
+
+	/**
+	 * Acquires an object, placing it at a transform and initializing it before it is prepared for usage.
+	 * @param Transform The transform to place the object at
+	 * @param Initializer Called with the dormant object after placing it
+	 * @param OutSlotId Receives the slot id of the acquired object, left unset for transient objects
+	 * @param bAllowTransient Whether a full pool may hand out a transient object under the SpawnTransient policy
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireAtInternal(const FTransform& Transform, TFunctionRef<void(UObject*)> Initializer, FRavenPoolSlotId& OutSlotId,
+	                           bool bAllowTransient);
+
+	/**
+	 * Acquires a batch of objects, optionally placing them at transforms.
+	 * @param Count The number of objects to acquire
+	 * @param Transforms One transform per object, or nullptr to leave the objects where they are
+	 * @param OutObjects Receives the acquired objects
+	 * @return The number of objects acquired
+	 */
+	int32 AcquireBatch(int32 Count, const FTransform* Transforms, TArray<UObject*>& OutObjects);
+
+	/**
+	 * Moves an actor or scene component to a transform, teleporting physics. Other objects are left untouched.
+	 * @param Object The object to move
+	 * @param Transform The transform to move it to
+	 */
+	static void ApplyTransform(UObject* Object, const FTransform& Transform);
+
 	/**
 	 * Finds an inactive object using the configured acquisition strategy.
+	 * @param Location The location the object will be used at, or nullptr if unknown
 	 * @return Index of inactive object, or INDEX_NONE if none available
 	 */
-	int32 FindInactiveObject();
+	int32 FindInactiveObject(const FVector* Location = nullptr);
+
+	/**
+	 * Tells a stateful acquisition strategy that a slot became available, along with its location if needed.
+	 * @param Index The slot that became available
+	 */
+	void NotifyStrategyReleased(int32 Index);
+
+	/**
+	 * Creates the acquisition strategy for the current policy and feeds it the current inactive objects.
+	 */
+	void RecreateAcquisitionStrategy();
+
+	/**
+	 * Stores an object in a vacant slot (or a new one if none are vacant).
+	 * @param Object The object to store
+	 * @param bIsActive Whether the object is handed out immediately
+	 * @param CurrentTime The time the object is stored at
+	 * @return Index of the slot the object was stored in
+	 */
+	int32 AllocateSlot(UObject* Object, bool bIsActive, double CurrentTime);
+
+	/**
+	 * Destroys the object in a slot and returns the slot to the vacant list.
+	 * Other slots are not moved.
+	 * @param Index The slot to free
+	 */
+	void DestroySlot(int32 Index);
+
+	/**
+	 * Links an active slot into the list of its owner, creating the list if needed.
+	 * @param Index The active slot
+	 * @param Owner The owner the slot was acquired for
+	 */
+	void LinkOwner(int32 Index, const UObject* Owner);
+
+	/**
+	 * Unlinks a slot from its owner list, freeing the list when it becomes empty.
+	 * @param Index The slot to unlink
+	 */
+	void UnlinkOwner(int32 Index);
+
+	/**
+	 * Releases every slot of an owner list. Slots whose object is no longer valid are removed from the pool.
+	 * The list itself is freed along with its last entry.
+	 * @param ListIndex The owner list to release
+	 * @param CurrentTime The release time
+	 * @return The number of objects released
+	 */
+	int32 ReleaseOwnerList(int32 ListIndex, double CurrentTime);
+
+	/**
+	 * Returns the objects of owners that were garbage collected.
+	 * @param CurrentTime The release time
+	 */
+	void ReclaimOrphanedObjects(double CurrentTime);
+
+	/**
+	 * Finds the reservation a ticket refers to.
+	 * @return The reservation, or nullptr if the ticket is stale or belongs to another pool
+	 */
+	FRavenPoolReservation* FindReservation(const FRavenPoolReservationTicket& Ticket);
+	const FRavenPoolReservation* FindReservation(const FRavenPoolReservationTicket& Ticket) const;
+
+	/**
+	 * Moves an entry from the free list into a reservation.
+	 * @param Index The inactive entry
+	 * @param ReservationIndex The reservation to move it into
+	 */
+	void ReserveSlot(int32 Index, int32 ReservationIndex);
+
+	/**
+	 * Takes an entry out of its reservation, without putting it anywhere else.
+	 * @param Index The reserved entry
+	 */
+	void UnreserveSlot(int32 Index);
+
+	/**
+	 * Returns the unused entries of a reservation to the free list and frees it.
+	 * @param ReservationIndex The reservation to free
+	 * @param CurrentTime The time the entries are returned at
+	 */
+	void FreeReservation(int32 ReservationIndex, double CurrentTime);
+
+	/**
+	 * Releases the active object in a slot back to the pool.
+	 * @param Index The slot to release
+	 * @param CurrentTime The release time
+	 * @return True if the object was released
+	 */
+	bool ReleaseSlot(int32 Index, double CurrentTime);
+
+	/**
+	 * Marks an inactive slot as active: takes it off the free list and updates counters and strategy.
+	 * Does not call any object or factory hooks.
+	 * @param Index The slot to activate
+	 * @param CurrentTime The acquisition time
+	 */
+	void ActivateSlot(int32 Index, double CurrentTime);
+
+	/**
+	 * Marks an active slot as inactive: appends it to the free list, invalidates its slot ids and
+	 * updates counters and strategy. Does not call any object or factory hooks.
+	 * @param Index The slot to deactivate
+	 * @param CurrentTime The release time
+	 */
+	void DeactivateSlot(int32 Index, double CurrentTime);
+
+	/**
+	 * Reserves all per-slot bookkeeping for the given number of objects.
+	 * @param Capacity The number of objects to reserve for
+	 */
+	void Reserve(int32 Capacity);
+
+	/** Gets the number of objects shrinking and idle expiry keep, the adaptive target if adaptive sizing is on */
+	int32 GetRetainedPoolSize() const { return Policy.bAdaptiveSizing ? AdaptiveTargetSize : Policy.MinPoolSize; }
+
+	/**
+	 * Samples demand into the decaying averages, moves the adaptive target with hysteresis and queues
+	 * creations or trims idle objects to bring the pool towards it.
+	 * @param CurrentTime The current platform time in seconds
+	 */
+	void UpdateAdaptiveTarget(double CurrentTime);
+
+	/**
+	 * Queues objects for TickPreWarm that don't count towards the pre-warm progress.
+	 * @param Count The number of objects to queue
+	 */
+	void QueueBackgroundPreWarm(int32 Count);
+
+	/** Appends an active slot to the acquisition order list, if the overflow policy needs it */
+	void LinkActive(int32 Index);
+
+	/** Removes an active slot from the acquisition order list, if the overflow policy needs it */
+	void UnlinkActive(int32 Index);
+
+	/** Rebuilds the acquisition order list from the acquisition times after the overflow policy changed */
+	void RebuildActiveOrder();
+
+	/**
+	 * Releases the active object acquired the longest ago so it can be handed out again, calling
+	 * IPoolable::OnReclaimedByPool first.
+	 * @param CurrentTime The release time
+	 * @return The slot of the recycled object, now inactive, or INDEX_NONE if there was none to recycle
+	 */
+	int32 RecycleOldestActive(double CurrentTime);
+
+	/**
+	 * Creates an object that is not part of the pool, for the SpawnTransient overflow policy.
+	 * @return The object, or nullptr if creation failed
+	 */
+	UObject* CreateTransientObject();
+
+	/**
+	 * Destroys a transient object on release.
+	 * @param Object The object being released
+	 * @return True if the object was one of this pool's transient objects
+	 */
+	bool ReleaseTransient(UObject* Object);
+
+	/** Removes transient objects that were destroyed without being released from the transient set and counters */
+	void PruneTransientObjects();
+
+	/** Records an acquisition that failed because the pool was full, warning once per pool */
+	void ReportOverflowFailure();
+
+	/**
+	 * Whether another object may be created without exceeding the maximum pool size.
+	 */
+	bool HasCapacity() const { return MaxPoolSize <= 0 || NumObjects < MaxPoolSize; }
 
 	/**
-	 * Rebuilds the inactive indices cache.
+	 * Builds the slot id for an occupied slot.
+	 * @param Index The slot index
+	 * @return The slot id
 	 */
-	void RebuildInactiveIndices();
+	FRavenPoolSlotId MakeSlotId(int32 Index) const;
 
 	/**
-	 * Marks statistics as dirty for recalculation.
+	 * Validates that an object is still valid for reuse.
+	 * @param Object The object to check
+	 * @return True if valid, false otherwise
 	 */
-	void MarkStatsDirty() { bStatsDirty = true; }
+	bool IsValidForReuse(UObject* Object) const;
 
 private:
-	/** Array of pooled objects */
+	/** Cold per-slot bookkeeping */
 	UPROPERTY()
 	TArray<FRavenPoolEntry> Pool;
 
+	/** Pooled object per slot (nullptr for vacant slots) */
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> Objects;
+
+	/** Last acquire/release time per slot */
+	TArray<double> LastUsedTimes;
+
+	/** Set for every slot that holds an object */
+	TBitArray<> OccupiedSlots;
+
+	/** Set for every slot whose object is currently active/in use */
+	TBitArray<> ActiveSlots;
+
 	/** The class of objects this pool manages */
 	UPROPERTY()
 	TObjectPtr<UClass> ObjectClass = nullptr;
@@ -195,29 +718,111 @@ private:
 	UPROPERTY()
 	FRavenPoolPolicy Policy;
 
-	/** Cached indices of inactive objects for fast lookup */
-	TArray<int32> InactiveIndices;
+	/** Intrusive list of inactive entries, updated incrementally on acquire and release */
+	FRavenPoolFreeList FreeList;
 
 	/** Map from object to pool index for fast reverse lookup */
 	TMap<TObjectPtr<UObject>, int32> ObjectToIndex;
 
-	/** Whether the inactive indices cache is valid */
-	bool bInactiveIndicesDirty = true;
+	/** Head of the list of unoccupied slots */
+	int32 FirstVacantSlot = INDEX_NONE;
+
+	/** Number of occupied slots */
+	int32 NumObjects = 0;
+
+	/** Id assigned by the owning subsystem, stored in slot ids */
+	int32 PoolId = INDEX_NONE;
 
 	/** Acquisition strategy for selecting objects from pool */
 	TSharedPtr<IRavenPoolAcquisitionStrategy> AcquisitionStrategy;
 
-	/** Cached statistics */
-	mutable FRavenPoolStats CachedStats;
+	/** Whether the acquisition strategy keeps state and must be notified of slot state changes */
+	bool bStrategyNeedsNotifications = false;
+
+	/** Whether the acquisition strategy needs the location of released objects */
+	bool bStrategyNeedsLocations = false;
+
+	/** How the IPoolable and factory hooks are called for this pool's class, resolved when the pool is created */
+	FRavenPoolHookDispatch HookDispatch;
+
+	/** Occupancy and lifetime counters, updated on every state transition */
+	TSharedRef<FRavenPoolCounters, ESPMode::ThreadSafe> Counters = MakeShared<FRavenPoolCounters, ESPMode::ThreadSafe>();
+
+	/** Platform time of the next shrink operation (0 = not scheduled yet) */
+	double NextShrinkTime = 0.0;
+
+	/** Lists of the active entries acquired for each owner */
+	TSparseArray<FRavenPoolOwnerList> OwnerLists;
+
+	/** Owner list index by owner */
+	TMap<FObjectKey, int32> OwnerListsByKey;
+
+	/** Platform time of the next check for garbage collected owners */
+	double NextOwnerReclaimTime = 0.0;
+
+	/** Active burst reservations */
+	TSparseArray<FRavenPoolReservation> Reservations;
+
+	/** Number of reservations still waiting for objects */
+	int32 NumPendingReservations = 0;
+
+	/** Serial number of the next reservation */
+	uint32 NextReservationSerial = 1;
+
+	/** Number of objects queued by PreWarmAsync that are still to be created */
+	int32 PreWarmRemaining = 0;
 
-	/** Whether statistics need to be recalculated */
-	mutable bool bStatsDirty = true;
+	/** Number of those objects queued in the background rather than by PreWarmAsync */
+	int32 BackgroundPreWarmRemaining = 0;
 
-	/** Time since last shrink operation */
-	float TimeSinceLastShrink = 0.0f;
+	/** Callbacks of the PreWarmAsync calls in progress */
+	TArray<TFunction<void()>> PreWarmCallbacks;
+
+	/** Size adaptive sizing keeps the pool at */
+	int32 AdaptiveTargetSize = 0;
+
+	/** Highest number of active objects since the last adaptive sample */
+	int32 AdaptiveSamplePeak = 0;
+
+	/** Total acquisitions at the last adaptive sample */
+	int64 AdaptiveSampleAcquisitions = 0;
+
+	/** Time of the last adaptive sample, 0 before the first */
+	double LastAdaptiveSampleTime = 0.0;
+
+	/** Decaying peak of concurrently active objects; rises immediately, falls with the half-life */
+	double AdaptivePeakEstimate = 0.0;
+
+	/** Decaying average of acquisitions per second */
+	double AdaptiveAcquisitionRate = 0.0;
+
+	/** Acquisition rate when the target was last changed, lowering it again needs demand that is not rising */
+	double AdaptiveTargetRate = 0.0;
+
+	/** Objects created by the SpawnTransient overflow policy, destroyed on release */
+	UPROPERTY()
+	TSet<TObjectPtr<UObject>> TransientObjects;
+
+	/** Platform time of the next check for transient objects destroyed outside the pool */
+	double NextTransientPruneTime = 0.0;
+
+	/** Active entry acquired the longest ago, only tracked while the pool recycles on overflow */
+	int32 OldestActive = INDEX_NONE;
+
+	/** Active entry acquired most recently, only tracked while the pool recycles on overflow */
+	int32 NewestActive = INDEX_NONE;
+
+	/** Whether the active entries are linked in acquisition order for the RecycleOldest overflow policy */
+	bool bTrackActiveOrder = false;
+
+	/** Whether running out of capacity has already been logged as a warning */
+	bool bOverflowWarned = false;
 
 	friend class RAVEN_API URavenPoolSubsystem;
 
+	template <typename T, typename StrategyType, typename FactoryType>
+	friend class TRavenTypedPool;
+
 public:
 	friend RAVEN_API bool operator==(const FRavenPool& A, const UClass* B) { return A.ObjectClass == B; }
 };
@@ -0,0 +1,51 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "RavenPoolAcquireAsyncAction.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRavenPoolAcquireAsyncDelegate, UObject*, Object);
+
+/**
+ * Latent Blueprint node acquiring a pooled object without a synchronous creation hitch.
+ * Completes on the same frame if the pool has an inactive object, otherwise once the object has been created
+ * within the pool subsystem's per-frame creation budget.
+ */
+UCLASS()
+class RAVEN_API URavenPoolAcquireAsyncAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Acquires an object of the specified class from its pool asynchronously.
+	 * @param WorldContextObject Object providing the world whose pool subsystem is used
+	 * @param Class The class of object to acquire
+	 * @return The async action
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static URavenPoolAcquireAsyncAction* AcquireAsync(UObject* WorldContextObject, UClass* Class);
+
+	virtual void Activate() override;
+
+public:
+	/** Called with the acquired object */
+	UPROPERTY(BlueprintAssignable)
+	FRavenPoolAcquireAsyncDelegate OnAcquired;
+
+	/** Called if no object could be acquired */
+	UPROPERTY(BlueprintAssignable)
+	FRavenPoolAcquireAsyncDelegate OnFailed;
+
+private:
+	void HandleAcquired(UObject* Object);
+
+private:
+	UPROPERTY()
+	TObjectPtr<UObject> WorldContextObject;
+
+	UPROPERTY()
+	TObjectPtr<UClass> Class;
+};
@@ -0,0 +1,46 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Whether pools in no-allocation mode verify that their hot paths don't allocate */
+#ifndef RAVEN_POOL_ALLOCATION_CHECKS
+#define RAVEN_POOL_ALLOCATION_CHECKS !UE_BUILD_SHIPPING
+#endif
+
+#if RAVEN_POOL_ALLOCATION_CHECKS
+
+/**
+ * Counts the heap allocations made by the current thread while in scope and raises an ensure if there were any.
+ * Allocations are counted by a proxy allocator that is only installed when running with -RavenPoolAllocationChecks,
+ * so without the switch the scope costs a single branch.
+ */
+class RAVEN_API FRavenPoolNoAllocationScope
+{
+public:
+	FRavenPoolNoAllocationScope(bool bEnabled, const TCHAR* InContext);
+	~FRavenPoolNoAllocationScope();
+
+	FRavenPoolNoAllocationScope(const FRavenPoolNoAllocationScope&) = delete;
+	FRavenPoolNoAllocationScope& operator=(const FRavenPoolNoAllocationScope&) = delete;
+
+	/**
+	 * Installs the counting allocator in front of GMalloc if requested on the command line.
+	 * Called once when the module starts up.
+	 */
+	static void InstallIfRequested();
+
+private:
+	const TCHAR* Context = nullptr;
+	uint64 StartCount = 0;
+	bool bActive = false;
+};
+
+#define RAVEN_POOL_NO_ALLOCATION_SCOPE(bEnabled, Context) const FRavenPoolNoAllocationScope ANONYMOUS_VARIABLE(RavenPoolNoAllocationScope)(bEnabled, TEXT(Context))
+
+#else
+
+#define RAVEN_POOL_NO_ALLOCATION_SCOPE(bEnabled, Context)
+
+#endif
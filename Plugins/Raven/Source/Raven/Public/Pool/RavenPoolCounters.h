@@ -0,0 +1,200 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Pool/RavenPoolTypes.h"
+
+#include <atomic>
+
+/**
+ * Occupancy and lifetime counters of a single pool.
+ * Written only by the game thread, incrementally on every state transition, so reading a count is O(1).
+ * Any thread may take a Snapshot(): updates are published through a sequence lock, so readers always see
+ * a consistent set of values without ever blocking the game thread.
+ * Unlike the cycle stats, the counters are maintained in all build configurations.
+ */
+class RAVEN_API FRavenPoolCounters
+{
+public:
+	/**
+	 * Records an object being added to the pool.
+	 * @param bIsActive Whether the object was handed out immediately
+	 */
+	void OnObjectCreated(const bool bIsActive)
+	{
+		BeginUpdate();
+		const int32 NewTotal = TotalCount.load(std::memory_order_relaxed) + 1;
+		TotalCount.store(NewTotal, std::memory_order_relaxed);
+		PeakPoolSize.store(FMath::Max(PeakPoolSize.load(std::memory_order_relaxed), NewTotal), std::memory_order_relaxed);
+		Increment(TotalCreated);
+		if (bIsActive)
+		{
+			Increment(ActiveCount);
+			Increment(TotalAcquisitions);
+			Increment(TotalSynchronousCreations);
+		}
+		EndUpdate();
+	}
+
+	/**
+	 * Records an object being removed from the pool.
+	 * @param bWasActive Whether the object was active when it was removed
+	 */
+	void OnObjectDestroyed(const bool bWasActive)
+	{
+		BeginUpdate();
+		Increment(TotalCount, -1);
+		Increment(TotalDestroyed);
+		if (bWasActive)
+		{
+			Increment(ActiveCount, -1);
+		}
+		EndUpdate();
+	}
+
+	/**
+	 * Records an inactive object being reused.
+	 */
+	void OnObjectReused()
+	{
+		BeginUpdate();
+		Increment(ActiveCount);
+		Increment(TotalAcquisitions);
+		Increment(TotalReuses);
+		EndUpdate();
+	}
+
+	/**
+	 * Records an active object being released back to the pool.
+	 */
+	void OnObjectReleased()
+	{
+		BeginUpdate();
+		Increment(ActiveCount, -1);
+		Increment(TotalReleases);
+		EndUpdate();
+	}
+
+	/**
+	 * Records an acquisition that failed because the pool was full.
+	 */
+	void OnOverflowFailed()
+	{
+		BeginUpdate();
+		Increment(TotalOverflowFailures);
+		EndUpdate();
+	}
+
+	/**
+	 * Records an active object being recycled because the pool was full. Its release and reacquisition are
+	 * recorded separately.
+	 */
+	void OnOverflowRecycled()
+	{
+		BeginUpdate();
+		Increment(TotalOverflowRecycles);
+		EndUpdate();
+	}
+
+	/**
+	 * Records a transient object being created because the pool was full.
+	 */
+	void OnTransientCreated()
+	{
+		BeginUpdate();
+		Increment(TransientCount);
+		Increment(TotalOverflowTransients);
+		Increment(TotalAcquisitions);
+		EndUpdate();
+	}
+
+	/**
+	 * Records a transient object being released and destroyed.
+	 */
+	void OnTransientDestroyed()
+	{
+		BeginUpdate();
+		Increment(TransientCount, -1);
+		Increment(TotalReleases);
+		EndUpdate();
+	}
+
+	/**
+	 * Records the size adaptive sizing keeps the pool at.
+	 * @param TargetSize The new target size
+	 */
+	void SetAdaptiveTargetSize(const int32 TargetSize)
+	{
+		BeginUpdate();
+		AdaptiveTargetSize.store(TargetSize, std::memory_order_relaxed);
+		EndUpdate();
+	}
+
+	/**
+	 * Records the reuse of an object a static idle policy would have destroyed.
+	 */
+	void OnCycleAvoided()
+	{
+		BeginUpdate();
+		Increment(TotalCyclesAvoided);
+		EndUpdate();
+	}
+
+	/** Gets the number of objects in the pool */
+	int32 GetTotalCount() const { return TotalCount.load(std::memory_order_relaxed); }
+
+	/** Gets the number of active objects */
+	int32 GetActiveCount() const { return ActiveCount.load(std::memory_order_relaxed); }
+
+	/** Gets the number of inactive objects */
+	int32 GetInactiveCount() const { return GetTotalCount() - GetActiveCount(); }
+
+	/** Gets the number of acquisitions since the pool was created */
+	int64 GetTotalAcquisitions() const { return TotalAcquisitions.load(std::memory_order_relaxed); }
+
+	/**
+	 * Takes a consistent copy of all counters. Safe to call from any thread.
+	 * @return The pool statistics
+	 */
+	FRavenPoolStats Snapshot() const;
+
+private:
+	template <typename T>
+	static void Increment(std::atomic<T>& Counter, const T Delta = 1)
+	{
+		// Single writer, so a plain load/store pair is enough and avoids a locked read-modify-write
+		Counter.store(Counter.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+	}
+
+	void BeginUpdate()
+	{
+		Sequence.store(Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+
+	void EndUpdate()
+	{
+		Sequence.store(Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+private:
+	/** Odd while the game thread is updating the counters */
+	std::atomic<uint32> Sequence{0};
+
+	std::atomic<int32> TotalCount{0};
+	std::atomic<int32> ActiveCount{0};
+	std::atomic<int32> PeakPoolSize{0};
+	std::atomic<int64> TotalCreated{0};
+	std::atomic<int64> TotalDestroyed{0};
+	std::atomic<int64> TotalAcquisitions{0};
+	std::atomic<int64> TotalReleases{0};
+	std::atomic<int64> TotalReuses{0};
+	std::atomic<int64> TotalSynchronousCreations{0};
+	std::atomic<int32> TransientCount{0};
+	std::atomic<int64> TotalOverflowFailures{0};
+	std::atomic<int64> TotalOverflowRecycles{0};
+	std::atomic<int64> TotalOverflowTransients{0};
+	std::atomic<int32> AdaptiveTargetSize{0};
+	std::atomic<int64> TotalCyclesAvoided{0};
+};
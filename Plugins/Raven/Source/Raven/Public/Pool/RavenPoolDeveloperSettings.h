@@ -20,9 +20,9 @@ struct RAVEN_API FRavenPoolConfig
 {
 	GENERATED_BODY()
 
-	/** The class of objects to pool */
+	/** The class of objects to pool, loaded asynchronously when the pool subsystem starts */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Basic", meta=(BlueprintProtected = "true"))
-	TObjectPtr<UClass> Class;
+	TSoftClassPtr<UObject> Class;
 
 	/** The factory class to use for creating and managing pooled objects */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Basic", meta=(BlueprintProtected = "true"))
@@ -32,6 +32,10 @@ struct RAVEN_API FRavenPoolConfig
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Size", meta=(BlueprintProtected = "true", ClampMin = "0"))
 	int32 InitialPoolSize = 0;
 
+	/** Create the initial objects over several frames within the pre-warm budget instead of while the world initializes */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Size", meta=(BlueprintProtected = "true", EditCondition = "InitialPoolSize > 0"))
+	bool bPreWarmAsync = false;
+
 	/** Maximum number of objects allowed in the pool (0 = unlimited) */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Size", meta=(BlueprintProtected = "true", ClampMin = "0"))
 	int32 MaxPoolSize = 0;
@@ -39,6 +43,10 @@ struct RAVEN_API FRavenPoolConfig
 	/** Pool management policy */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Policy", meta=(BlueprintProtected = "true"))
 	FRavenPoolPolicy Policy;
+
+	/** Maps the pool is loaded and created in (empty = every map). Other maps never load the class or factory. */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Loading", meta=(BlueprintProtected = "true"))
+	TArray<TSoftObjectPtr<UWorld>> Maps;
 };
 
 /**
@@ -62,8 +70,53 @@ public:
 	UFUNCTION(BlueprintPure, Category="Raven|Pool")
 	const TArray<FRavenPoolConfig>& GetPoolConfigs() const;
 
+	/**
+	 * Gets the time per frame the pool subsystem may spend creating objects for asynchronous requests.
+	 * @return The budget in seconds
+	 */
+	double GetAsyncCreationBudget() const { return AsyncCreationBudgetMs / 1000.0; }
+
+	/**
+	 * Gets the time per frame the pool subsystem may spend on asynchronous pre-warming.
+	 * @return The budget in seconds
+	 */
+	double GetPreWarmBudget() const { return PreWarmBudgetMs / 1000.0; }
+
+	/** Whether every play session records its pool usage to a run file when its world ends */
+	bool ShouldRecordUsageProfiles() const { return bRecordUsageProfiles; }
+
+	/** Whether pools are pre-warmed from the merged usage profile of their map, when there is one */
+	bool ShouldPreWarmFromUsageProfiles() const { return bPreWarmFromUsageProfiles; }
+
+	/** Gets the length of a sample window of recorded usage curves in seconds */
+	float GetUsageProfileSampleInterval() const { return FMath::Max(UsageProfileSampleInterval, 0.1f); }
+
 protected:
 	/** Array of pool configurations defining which classes to pool and their factories */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Config", meta = (BlueprintProtected = "true"))
 	TArray<FRavenPoolConfig> PoolConfigs;
+
+	/** Milliseconds per frame the pool subsystem may spend creating objects for asynchronous requests (at least one object is created per frame) */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Async", meta = (BlueprintProtected = "true", ClampMin = "0", Units = "ms"))
+	float AsyncCreationBudgetMs = 2.0f;
+
+	/** Milliseconds per frame the pool subsystem may spend on asynchronous pre-warming (at least one object per pool is created per frame) */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Async", meta = (BlueprintProtected = "true", ClampMin = "0", Units = "ms"))
+	float PreWarmBudgetMs = 4.0f;
+
+	/**
+	 * Record the peak active objects and active curve of every pool per map and write them to
+	 * Saved/RavenPool/Runs when the world ends. Runs are merged into per-map profiles with the
+	 * Raven.Pool.MergeUsageProfiles editor command.
+	 */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Profiles", meta = (BlueprintProtected = "true"))
+	bool bRecordUsageProfiles = false;
+
+	/** Pre-warm pools to the peak of their map's merged usage profile instead of their InitialPoolSize */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Profiles", meta = (BlueprintProtected = "true"))
+	bool bPreWarmFromUsageProfiles = true;
+
+	/** Length of a sample window of recorded usage curves */
+	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, Category = "Profiles", meta = (BlueprintProtected = "true", ClampMin = "0.1", Units = "s"))
+	float UsageProfileSampleInterval = 5.0f;
 };
@@ -0,0 +1,126 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Intrusive free list over the inactive entries of a pool.
+ * Entries are linked in release order through their FreePrev/FreeNext members, so the oldest
+ * released entry is always at the head and the most recently released one at the tail.
+ * A dense index array (with each entry storing its position in FreeSlot) allows picking a
+ * random inactive entry and removing arbitrary entries in O(1).
+ */
+class FRavenPoolFreeList
+{
+public:
+	/**
+	 * Appends an entry as the most recently released one.
+	 * @param Entries The pool entries
+	 * @param Index The index of the entry to add
+	 */
+	template <typename EntryType>
+	void Push(TArray<EntryType>& Entries, const int32 Index)
+	{
+		EntryType& Entry = Entries[Index];
+		checkSlow(Entry.FreeSlot == INDEX_NONE);
+
+		Entry.FreePrev = Tail;
+		Entry.FreeNext = INDEX_NONE;
+		if (Tail != INDEX_NONE)
+		{
+			Entries[Tail].FreeNext = Index;
+		}
+		else
+		{
+			Head = Index;
+		}
+		Tail = Index;
+
+		Entry.FreeSlot = Dense.Add(Index);
+	}
+
+	/**
+	 * Unlinks an entry from the free list.
+	 * @param Entries The pool entries
+	 * @param Index The index of the entry to remove
+	 */
+	template <typename EntryType>
+	void Remove(TArray<EntryType>& Entries, const int32 Index)
+	{
+		EntryType& Entry = Entries[Index];
+		checkSlow(Entry.FreeSlot != INDEX_NONE);
+
+		if (Entry.FreePrev != INDEX_NONE)
+		{
+			Entries[Entry.FreePrev].FreeNext = Entry.FreeNext;
+		}
+		else
+		{
+			Head = Entry.FreeNext;
+		}
+
+		if (Entry.FreeNext != INDEX_NONE)
+		{
+			Entries[Entry.FreeNext].FreePrev = Entry.FreePrev;
+		}
+		else
+		{
+			Tail = Entry.FreePrev;
+		}
+
+		// Swap the last dense element into the vacated position
+		const int32 LastIndex = Dense.Last();
+		Dense[Entry.FreeSlot] = LastIndex;
+		Entries[LastIndex].FreeSlot = Entry.FreeSlot;
+		Dense.Pop(EAllowShrinking::No);
+
+		Entry.FreePrev = INDEX_NONE;
+		Entry.FreeNext = INDEX_NONE;
+		Entry.FreeSlot = INDEX_NONE;
+	}
+
+	/**
+	 * Reserves memory for the given number of entries.
+	 * @param Capacity The number of entries to reserve for
+	 */
+	void Reserve(const int32 Capacity)
+	{
+		Dense.Reserve(Capacity);
+	}
+
+	/**
+	 * Removes all entries from the free list without touching the entries themselves.
+	 */
+	void Reset()
+	{
+		Head = INDEX_NONE;
+		Tail = INDEX_NONE;
+		Dense.Reset();
+	}
+
+	/** Gets the index of the oldest released entry, or INDEX_NONE if empty */
+	int32 GetOldest() const { return Head; }
+
+	/** Gets the index of the most recently released entry, or INDEX_NONE if empty */
+	int32 GetNewest() const { return Tail; }
+
+	/** Gets the entry index stored at the given dense position (0 <= DenseIndex < Num()) */
+	int32 GetAt(const int32 DenseIndex) const { return Dense[DenseIndex]; }
+
+	/** Gets the number of entries in the free list */
+	int32 Num() const { return Dense.Num(); }
+
+	/** Whether the free list is empty */
+	bool IsEmpty() const { return Dense.IsEmpty(); }
+
+private:
+	/** Index of the oldest released entry */
+	int32 Head = INDEX_NONE;
+
+	/** Index of the most recently released entry */
+	int32 Tail = INDEX_NONE;
+
+	/** Dense array of all entry indices in the free list (unordered) */
+	TArray<int32> Dense;
+};
@@ -12,6 +12,8 @@ class URavenPoolSubsystem;
  * Type-safe handle for pooled objects.
  * Automatically manages object lifetime and provides safe access to pooled objects.
  * When the handle is destroyed, the object is automatically released back to the pool.
+ * The handle refers to its pool slot by {pool id, slot, generation}, so releasing goes straight
+ * to the slot and a handle that outlived a reuse of its object is detected as stale.
  */
 template <typename T>
 struct TRavenPoolHandle
@@ -19,8 +21,9 @@ struct TRavenPoolHandle
 public:
 	TRavenPoolHandle() = default;
 
-	TRavenPoolHandle(T* InObject, UClass* InPoolClass, URavenPoolSubsystem* InSubsystem)
+	TRavenPoolHandle(T* InObject, const FRavenPoolSlotId& InSlotId, UClass* InPoolClass, URavenPoolSubsystem* InSubsystem)
 		: Object(InObject)
+		  , SlotId(InSlotId)
 		  , PoolClass(InPoolClass)
 		  , Subsystem(InSubsystem)
 		  , bAutoRelease(true)
@@ -30,6 +33,7 @@ public:
 	// Move constructor
 	TRavenPoolHandle(TRavenPoolHandle&& Other) noexcept
 		: Object(MoveTemp(Other.Object))
+		  , SlotId(Other.SlotId)
 		  , PoolClass(Other.PoolClass)
 		  , Subsystem(Other.Subsystem)
 		  , bAutoRelease(Other.bAutoRelease)
@@ -44,6 +48,7 @@ public:
 		{
 			Release();
 			Object = MoveTemp(Other.Object);
+			SlotId = Other.SlotId;
 			PoolClass = Other.PoolClass;
 			Subsystem = Other.Subsystem;
 			bAutoRelease = Other.bAutoRelease;
@@ -64,13 +69,41 @@ public:
 		}
 	}
 
+	/**
+	 * Acquires an object from the subsystem and wraps it in a handle.
+	 * @param InSubsystem The pool subsystem to acquire from
+	 * @param InPoolClass The class of object to acquire
+	 * @return A handle to the acquired object, or an invalid handle if acquisition failed
+	 */
+	static TRavenPoolHandle Acquire(URavenPoolSubsystem* InSubsystem, UClass* InPoolClass = T::StaticClass())
+	{
+		if (!InSubsystem)
+		{
+			return TRavenPoolHandle();
+		}
+
+		FRavenPoolSlotId AcquiredSlotId;
+		UObject* AcquiredObject = InSubsystem->AcquireSlot(InPoolClass, AcquiredSlotId);
+		if (T* TypedObject = Cast<T>(AcquiredObject))
+		{
+			return TRavenPoolHandle(TypedObject, AcquiredSlotId, InPoolClass, InSubsystem);
+		}
+
+		// Don't leak an acquisition of the wrong type
+		if (AcquiredObject)
+		{
+			InSubsystem->ReleaseSlot(AcquiredSlotId);
+		}
+		return TRavenPoolHandle();
+	}
+
 	/**
 	 * Gets the pooled object.
 	 * @return Pointer to the object, or nullptr if invalid
 	 */
 	T* Get() const
 	{
-		return Object.Get();
+		return IsValid() ? Object.Get() : nullptr;
 	}
 
 	/**
@@ -79,7 +112,7 @@ public:
 	 */
 	T* operator->() const
 	{
-		return Object.Get();
+		return Get();
 	}
 
 	/**
@@ -88,16 +121,16 @@ public:
 	 */
 	T& operator*() const
 	{
-		return *Object.Get();
+		return *Get();
 	}
 
 	/**
 	 * Checks if the handle is valid.
-	 * @return True if the object is valid, false otherwise
+	 * @return True if the object is valid and its slot has not been released or reused since, false otherwise
 	 */
 	bool IsValid() const
 	{
-		return Object.IsValid();
+		return Object.IsValid() && Subsystem.IsValid() && Subsystem->IsSlotValid(SlotId);
 	}
 
 	/**
@@ -114,9 +147,9 @@ public:
 	 */
 	void Release()
 	{
-		if (Object.IsValid() && Subsystem.IsValid())
+		if (Subsystem.IsValid())
 		{
-			Subsystem->Release(Object.Get());
+			Subsystem->ReleaseSlot(SlotId);
 		}
 		bAutoRelease = false;
 	}
@@ -139,6 +172,7 @@ public:
 	{
 		Release();
 		Object.Reset();
+		SlotId = FRavenPoolSlotId();
 		PoolClass = nullptr;
 		Subsystem = nullptr;
 	}
@@ -152,8 +186,18 @@ public:
 		return PoolClass;
 	}
 
+	/**
+	 * Gets the pool slot this handle refers to.
+	 * @return The slot id
+	 */
+	const FRavenPoolSlotId& GetSlotId() const
+	{
+		return SlotId;
+	}
+
 private:
 	TWeakObjectPtr<T> Object;
+	FRavenPoolSlotId SlotId;
 	TObjectPtr<UClass> PoolClass = nullptr;
 	TWeakObjectPtr<URavenPoolSubsystem> Subsystem;
 	bool bAutoRelease = false;
@@ -172,8 +216,9 @@ struct RAVEN_API FRavenPoolHandle
 public:
 	FRavenPoolHandle() = default;
 
-	FRavenPoolHandle(UObject* InObject, UClass* InPoolClass, URavenPoolSubsystem* InSubsystem)
+	FRavenPoolHandle(UObject* InObject, const FRavenPoolSlotId& InSlotId, UClass* InPoolClass, URavenPoolSubsystem* InSubsystem)
 		: Object(InObject)
+		  , SlotId(InSlotId)
 		  , PoolClass(InPoolClass)
 		  , Subsystem(InSubsystem)
 		  , bAutoRelease(true)
@@ -194,16 +239,16 @@ public:
 	 */
 	UObject* Get() const
 	{
-		return Object.Get();
+		return IsValid() ? Object.Get() : nullptr;
 	}
 
 	/**
 	 * Checks if the handle is valid.
-	 * @return True if the object is valid, false otherwise
+	 * @return True if the object is valid and its slot has not been released or reused since, false otherwise
 	 */
 	bool IsValid() const
 	{
-		return Object.IsValid();
+		return Object.IsValid() && Subsystem.IsValid() && Subsystem->IsSlotValid(SlotId);
 	}
 
 	/**
@@ -228,6 +273,7 @@ public:
 	{
 		Release();
 		Object.Reset();
+		SlotId = FRavenPoolSlotId();
 		PoolClass = nullptr;
 		Subsystem = nullptr;
 	}
@@ -241,10 +287,22 @@ public:
 		return PoolClass;
 	}
 
+	/**
+	 * Gets the pool slot this handle refers to.
+	 * @return The slot id
+	 */
+	const FRavenPoolSlotId& GetSlotId() const
+	{
+		return SlotId;
+	}
+
 private:
 	UPROPERTY()
 	TWeakObjectPtr<UObject> Object;
 
+	UPROPERTY()
+	FRavenPoolSlotId SlotId;
+
 	UPROPERTY()
 	TObjectPtr<UClass> PoolClass = nullptr;
 
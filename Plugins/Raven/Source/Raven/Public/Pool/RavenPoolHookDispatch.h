@@ -0,0 +1,155 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Pool/Factory/RavenPoolFactoryUObject.h"
+#include "Pool/Interface/Poolable.h"
+
+/**
+ * How a single pool hook is invoked.
+ */
+enum class ERavenPoolHookDispatch : uint8
+{
+	/** Nobody implements the hook, it is skipped */
+	None,
+
+	/** Implemented in C++ only, the native implementation is called directly */
+	Native,
+
+	/** Overridden in Blueprint, the hook goes through ProcessEvent */
+	Script
+};
+
+/**
+ * Per-class cache of how a pool calls the IPoolable hooks of its objects and the preparation hooks of its factory.
+ * Resolved once when the pool is created, so the hot paths neither check Implements<UPoolable>() nor go through
+ * ProcessEvent for hooks that are not overridden in Blueprint.
+ * Objects or factories of any other class than the resolved ones fall back to the generic dispatch.
+ */
+class RAVEN_API FRavenPoolHookDispatch
+{
+public:
+	/**
+	 * Resolves the dispatch of every hook for a pooled class and its factory.
+	 * @param ObjectClass The pooled class
+	 * @param Factory The pool's factory
+	 */
+	void Resolve(UClass* ObjectClass, const URavenPoolFactoryUObject* Factory);
+
+	/** Calls IPoolable::OnAcquiredFromPool */
+	void OnAcquiredFromPool(UObject* Object) const
+	{
+		CallPoolableEvent(Object, AcquiredDispatch, AcquiredFunction, &IPoolable::OnAcquiredFromPool_Implementation, &IPoolable::Execute_OnAcquiredFromPool);
+	}
+
+	/** Calls IPoolable::OnReturnedToPool */
+	void OnReturnedToPool(UObject* Object) const
+	{
+		CallPoolableEvent(Object, ReturnedDispatch, ReturnedFunction, &IPoolable::OnReturnedToPool_Implementation, &IPoolable::Execute_OnReturnedToPool);
+	}
+
+	/** Calls IPoolable::OnReclaimedByPool */
+	void OnReclaimedByPool(UObject* Object) const
+	{
+		CallPoolableEvent(Object, ReclaimedDispatch, ReclaimedFunction, &IPoolable::OnReclaimedByPool_Implementation, &IPoolable::Execute_OnReclaimedByPool);
+	}
+
+	/** Calls IPoolable::OnPoolDestroy */
+	void OnPoolDestroy(UObject* Object) const
+	{
+		CallPoolableEvent(Object, DestroyDispatch, DestroyFunction, &IPoolable::OnPoolDestroy_Implementation, &IPoolable::Execute_OnPoolDestroy);
+	}
+
+	/** Calls IPoolable::IsValidForReuse, returning true for objects that don't implement it */
+	bool IsValidForReuse(UObject* Object) const;
+
+	/** Calls URavenPoolFactoryUObject::PrepareForUsage */
+	void PrepareForUsage(URavenPoolFactoryUObject* Factory, UObject* Object) const
+	{
+		if (Factory->GetClass() != FactoryClass || PrepareForUsageDispatch == ERavenPoolHookDispatch::Script)
+		{
+			Factory->PrepareForUsage(Object);
+		}
+		else if (PrepareForUsageDispatch == ERavenPoolHookDispatch::Native)
+		{
+			Factory->PrepareForUsage_Implementation(Object);
+		}
+	}
+
+	/** Calls URavenPoolFactoryUObject::PrepareForStorage */
+	void PrepareForStorage(URavenPoolFactoryUObject* Factory, UObject* Object) const
+	{
+		if (Factory->GetClass() != FactoryClass || PrepareForStorageDispatch == ERavenPoolHookDispatch::Script)
+		{
+			Factory->PrepareForStorage(Object);
+		}
+		else if (PrepareForStorageDispatch == ERavenPoolHookDispatch::Native)
+		{
+			Factory->PrepareForStorage_Implementation(Object);
+		}
+	}
+
+private:
+	void CallPoolableEvent(UObject* Object, const ERavenPoolHookDispatch Dispatch, UFunction* Function,
+		void (IPoolable::*NativeImplementation)(), void (*Execute)(UObject*)) const
+	{
+		if (Object->GetClass() != ObjectClass)
+		{
+			// Not the resolved class, use the generic dispatch
+			if (Object->Implements<UPoolable>())
+			{
+				Execute(Object);
+			}
+			return;
+		}
+
+		switch (Dispatch)
+		{
+		case ERavenPoolHookDispatch::Native:
+			(GetNativePoolable(Object)->*NativeImplementation)();
+			break;
+		case ERavenPoolHookDispatch::Script:
+			Object->ProcessEvent(Function, nullptr);
+			break;
+		default:
+			break;
+		}
+	}
+
+	/** Gets the IPoolable of an object of the resolved class from the cached interface offset */
+	IPoolable* GetNativePoolable(UObject* Object) const
+	{
+		return reinterpret_cast<IPoolable*>(reinterpret_cast<uint8*>(Object) + PoolableOffset);
+	}
+
+	/** Resolves the dispatch of an IPoolable hook of the resolved object class */
+	ERavenPoolHookDispatch ResolvePoolableHook(FName FunctionName, UFunction*& OutFunction) const;
+
+	/** Resolves the dispatch of a factory hook */
+	static ERavenPoolHookDispatch ResolveFactoryHook(const UClass* Class, FName FunctionName);
+
+private:
+	/** The class the IPoolable dispatch was resolved for */
+	const UClass* ObjectClass = nullptr;
+
+	/** The factory class the factory dispatch was resolved for */
+	const UClass* FactoryClass = nullptr;
+
+	/** Offset of the IPoolable interface within objects of ObjectClass (only valid if implemented natively) */
+	int32 PoolableOffset = 0;
+
+	/** Blueprint overrides of the IPoolable events */
+	UFunction* AcquiredFunction = nullptr;
+	UFunction* ReturnedFunction = nullptr;
+	UFunction* ReclaimedFunction = nullptr;
+	UFunction* DestroyFunction = nullptr;
+
+	ERavenPoolHookDispatch AcquiredDispatch = ERavenPoolHookDispatch::None;
+	ERavenPoolHookDispatch ReturnedDispatch = ERavenPoolHookDispatch::None;
+	ERavenPoolHookDispatch ReclaimedDispatch = ERavenPoolHookDispatch::None;
+	ERavenPoolHookDispatch DestroyDispatch = ERavenPoolHookDispatch::None;
+	ERavenPoolHookDispatch ValidForReuseDispatch = ERavenPoolHookDispatch::None;
+	ERavenPoolHookDispatch PrepareForUsageDispatch = ERavenPoolHookDispatch::Native;
+	ERavenPoolHookDispatch PrepareForStorageDispatch = ERavenPoolHookDispatch::Native;
+};
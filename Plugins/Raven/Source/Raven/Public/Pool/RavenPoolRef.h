@@ -0,0 +1,123 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RavenPoolSubsystem.h"
+
+/**
+ * Typed reference to a single pool of a subsystem.
+ * Resolve it once (e.g. in BeginPlay) and acquire and release through it without repeating the
+ * class-to-pool lookup. Pools live at stable addresses for the lifetime of their subsystem, and the
+ * reference becomes invalid once the subsystem is deinitialized.
+ */
+template <typename T>
+class TRavenPoolRef
+{
+public:
+	TRavenPoolRef() = default;
+
+	/**
+	 * Resolves the pool for a class, creating it if needed.
+	 * @param InSubsystem The pool subsystem owning the pool
+	 * @param InPoolClass The pooled class, which must be T or a subclass of it
+	 * @return A reference to the pool, or an invalid reference if no pool could be resolved
+	 */
+	static TRavenPoolRef Resolve(URavenPoolSubsystem* InSubsystem, UClass* InPoolClass = T::StaticClass())
+	{
+		TRavenPoolRef Ref;
+		if (!InSubsystem || !InPoolClass || !InPoolClass->IsChildOf(T::StaticClass()))
+		{
+			return Ref;
+		}
+
+		if (FRavenPool* ResolvedPool = InSubsystem->GetPool(InPoolClass))
+		{
+			Ref.Pool = ResolvedPool;
+			Ref.PoolId = ResolvedPool->GetPoolId();
+			Ref.Subsystem = InSubsystem;
+		}
+		return Ref;
+	}
+
+	/**
+	 * Acquires an object from the pool.
+	 * @return The acquired object, or nullptr if the reference is invalid or acquisition fails
+	 */
+	T* Acquire() const
+	{
+		return IsValid() ? CastChecked<T>(Pool->Acquire(), ECastCheckedType::NullAllowed) : nullptr;
+	}
+
+	/**
+	 * Acquires an object from the pool and returns the id of the slot it occupies.
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if the reference is invalid or acquisition fails
+	 */
+	T* Acquire(FRavenPoolSlotId& OutSlotId) const
+	{
+		OutSlotId = FRavenPoolSlotId();
+		return IsValid() ? CastChecked<T>(Pool->Acquire(OutSlotId), ECastCheckedType::NullAllowed) : nullptr;
+	}
+
+	/**
+	 * Releases an object back to the pool.
+	 * @param Object The object to release
+	 * @return True if the object was released
+	 */
+	bool Release(T* Object) const
+	{
+		return IsValid() && Pool->Release(Object);
+	}
+
+	/**
+	 * Releases the object in the given slot back to the pool.
+	 * @param SlotId The slot id returned on acquisition
+	 * @return True if the object was released
+	 */
+	bool Release(const FRavenPoolSlotId& SlotId) const
+	{
+		return IsValid() && Pool->Release(SlotId);
+	}
+
+	/**
+	 * Checks if the referenced pool still exists.
+	 * @return True if the subsystem is alive and still owns the pool
+	 */
+	bool IsValid() const
+	{
+		return Pool && Subsystem.IsValid() && Subsystem->GetPoolById(PoolId) == Pool;
+	}
+
+	/**
+	 * Implicit conversion to bool for validity checks.
+	 */
+	explicit operator bool() const
+	{
+		return IsValid();
+	}
+
+	/**
+	 * Checks if this reference is valid and refers to the pool of the given class.
+	 * @param InPoolClass The pooled class
+	 * @return True if the reference can be used for this class
+	 */
+	bool IsBoundTo(const UClass* InPoolClass) const
+	{
+		return IsValid() && Pool->GetObjectClass() == InPoolClass;
+	}
+
+	/**
+	 * Gets the referenced pool.
+	 * @return The pool, or nullptr if the reference is invalid
+	 */
+	FRavenPool* GetPool() const
+	{
+		return IsValid() ? Pool : nullptr;
+	}
+
+private:
+	FRavenPool* Pool = nullptr;
+	int32 PoolId = INDEX_NONE;
+	TWeakObjectPtr<URavenPoolSubsystem> Subsystem;
+};
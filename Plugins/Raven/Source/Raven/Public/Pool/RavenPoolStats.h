@@ -42,12 +42,15 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Tick"), STAT_Pool_Tick, STATGROUP_RavenPool
 /** Time spent validating pooled objects */
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Validate"), STAT_Pool_Validate, STATGROUP_RavenPool, RAVEN_API);
 
-/** Time spent rebuilding inactive object indices cache */
-DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool RebuildIndices"), STAT_Pool_RebuildIndices, STATGROUP_RavenPool, RAVEN_API);
-
 /** Time spent finding inactive objects using acquisition strategy */
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool FindInactive"), STAT_Pool_FindInactive, STATGROUP_RavenPool, RAVEN_API);
 
+/** Time spent acquiring batches of objects from the pool */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool AcquireMany"), STAT_Pool_AcquireMany, STATGROUP_RavenPool, RAVEN_API);
+
+/** Time spent releasing batches of objects back to the pool */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool ReleaseMany"), STAT_Pool_ReleaseMany, STATGROUP_RavenPool, RAVEN_API);
+
 // ============================================================================
 // Subsystem Statistics (URavenPoolSubsystem)
 // ============================================================================
@@ -58,6 +61,12 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem Acquire"), STAT_PoolSubsystem_Acquire,
 /** Total time to release object including pool lookup */
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem Release"), STAT_PoolSubsystem_Release, STATGROUP_RavenPool, RAVEN_API);
 
+/** Total time to acquire a batch of objects including pool lookup */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem AcquireMany"), STAT_PoolSubsystem_AcquireMany, STATGROUP_RavenPool, RAVEN_API);
+
+/** Total time to release a batch of objects including pool lookups */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem ReleaseMany"), STAT_PoolSubsystem_ReleaseMany, STATGROUP_RavenPool, RAVEN_API);
+
 /** Time spent ticking all pools for maintenance */
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem Tick"), STAT_PoolSubsystem_Tick, STATGROUP_RavenPool, RAVEN_API);
 
@@ -4,10 +4,24 @@
 
 #include "CoreMinimal.h"
 #include "RavenPool.h"
+#include "RavenPoolTimingWheel.h"
+#include "RavenConcurrentPool.h"
+#include "RavenPoolUsageProfile.h"
+#include "Containers/Queue.h"
+#include "Tasks/Task.h"
+#include "Engine/StreamableManager.h"
 
 #include "Subsystems/WorldSubsystem.h"
 #include "RavenPoolSubsystem.generated.h"
 
+template <typename T>
+class TRavenPoolRef;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRavenPoolPreWarmProgressDelegate, int32, NumCreated, int32, NumTotal);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRavenPoolLoadedDelegate, UClass*, PoolClass);
+
+struct FRavenPoolConfig;
+
 /**
  * World subsystem that manages object pools.
  * Provides centralized access to acquire and release pooled objects.
@@ -20,11 +34,44 @@ class RAVEN_API URavenPoolSubsystem : public UTickableWorldSubsystem
 public:
 	/**
 	 * Acquires an object of the specified class from the pool.
+	 * If an owner is given, the object can be returned together with everything else acquired for that owner
+	 * through ReleaseAllForOwner, and is returned automatically once the owner is garbage collected.
 	 * @param Class The class of object to acquire
+	 * @param Owner Optional owner or scope the object is acquired for
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool", meta = (AdvancedDisplay = "Owner"))
+	UObject* Acquire(UClass* Class, UObject* Owner = nullptr);
+
+	/**
+	 * Acquires an object of the specified class that is going to be used at the given location.
+	 * Pools using the Nearest acquisition strategy reuse the inactive object closest to the location.
+	 * @param Class The class of object to acquire
+	 * @param Location The location the object will be used at
 	 * @return The acquired object, or nullptr if acquisition fails
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
-	UObject* Acquire(UClass* Class);
+	UObject* AcquireNear(UClass* Class, const FVector& Location);
+
+	/**
+	 * Acquires an object of the specified class, placed at a transform and initialized before it is activated.
+	 * Actors are teleported there without sweeping while still dormant, so they never appear, collide or tick
+	 * at their storage location.
+	 * @param Class The class of object to acquire
+	 * @param Transform The transform to place the object at
+	 * @param Initializer Called with the dormant object after placing it and before any acquisition hook
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireAt(UClass* Class, const FTransform& Transform, TFunctionRef<void(UObject*)> Initializer);
+
+	/**
+	 * Acquires an object of the specified class, placed at a transform before it is activated.
+	 * @param Class The class of object to acquire
+	 * @param Transform The transform to place the object at
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool", meta = (DisplayName = "Acquire At"))
+	UObject* AcquireAtTransform(UClass* Class, const FTransform& Transform);
 
 	/**
 	 * Releases an object back to its pool for reuse.
@@ -34,6 +81,176 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
 	bool Release(UObject* Object);
 
+	/**
+	 * Releases every object acquired for an owner back to its pool.
+	 * @param Owner The owner the objects were acquired for
+	 * @return The number of objects released
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	int32 ReleaseAllForOwner(UObject* Owner);
+
+	/**
+	 * Acquires an object that is released automatically after a fixed lifetime of world time.
+	 * Releasing the object earlier is fine, the pending release is then ignored.
+	 * @param Class The class of object to acquire
+	 * @param Lifetime Seconds of world time until the object is released (0 or less = at the end of the frame)
+	 * @param Owner Optional owner or scope the object is acquired for
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool", meta = (AdvancedDisplay = "Owner"))
+	UObject* AcquireWithLifetime(UClass* Class, float Lifetime, UObject* Owner = nullptr);
+
+	/**
+	 * Acquires an object that is released automatically at the end of the current frame.
+	 * @param Class The class of object to acquire
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	UObject* AcquireForFrame(UClass* Class);
+
+	/**
+	 * Schedules the release of an acquired slot after a delay of world time.
+	 * @param SlotId The slot id returned on acquisition
+	 * @param Delay Seconds of world time until the release (0 or less = at the end of the frame)
+	 */
+	void ReleaseAfter(const FRavenPoolSlotId& SlotId, float Delay);
+
+	/**
+	 * Queues an object to be released on the next subsystem tick. Safe to call from any thread.
+	 * Queued releases are drained once per frame and prepared for storage in one batch per pool.
+	 * @param Object The object to release
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	void ReleaseDeferred(UObject* Object);
+
+	/**
+	 * Queues a slot to be released on the next subsystem tick. Safe to call from any thread.
+	 * @param SlotId The slot id returned on acquisition
+	 */
+	void ReleaseSlotDeferred(const FRavenPoolSlotId& SlotId);
+
+	/**
+	 * Gets or creates the concurrent pool for a non-actor class, which worker threads may acquire from and
+	 * release to. Must be called on the game thread; the returned pool stays valid until the subsystem is
+	 * deinitialized and may then be used from any thread.
+	 * Concurrent pools are separate from the regular pool of the same class and use its registered factory.
+	 * @param ObjectClass The class to pool, which must not be an actor
+	 * @return The concurrent pool, or nullptr if the class is invalid or has no factory
+	 */
+	FRavenConcurrentPool* GetConcurrentPool(UClass* ObjectClass);
+
+	/**
+	 * Acquires an object without creating one synchronously.
+	 * Completes immediately if the pool has an inactive object, otherwise the object is created on a later tick
+	 * within the per-frame creation budget of the developer settings.
+	 * @param Class The class of object to acquire
+	 * @param OnAcquired Called on the game thread with the acquired object, or nullptr if acquisition failed
+	 */
+	void AcquireAsync(UClass* Class, TUniqueFunction<void(UObject*)> OnAcquired);
+
+	/**
+	 * Acquires an object without creating one synchronously, see AcquireAsync with a callback.
+	 * The task completes on the game thread; its result is nullptr if acquisition failed.
+	 * @param Class The class of object to acquire
+	 * @return A task resolving to the acquired object
+	 */
+	UE::Tasks::TTask<UObject*> AcquireAsync(UClass* Class);
+
+	/**
+	 * Sets aside objects for a burst of acquisitions that must not create objects, such as an explosion's debris.
+	 * Inactive objects are reserved right away; the rest are created on the following ticks within the
+	 * per-frame creation budget. Reserved objects are not handed out by regular acquisitions.
+	 * @param Class The class of objects to reserve
+	 * @param Count The number of objects to reserve
+	 * @param Timeout Seconds after which the unused objects return to general use
+	 * @return The reservation ticket, unset if the class has no pool
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	FRavenPoolReservationTicket ReserveBurst(UClass* Class, int32 Count, float Timeout = 5.0f);
+
+	/**
+	 * Acquires one of the objects set aside by a reservation, without creating or allocating.
+	 * @param Ticket The ticket returned by ReserveBurst
+	 * @return The acquired object, or nullptr if no reserved object is ready
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	UObject* AcquireReserved(const FRavenPoolReservationTicket& Ticket);
+
+	/**
+	 * Returns the unused objects of a reservation to general use.
+	 * @param Ticket The ticket returned by ReserveBurst
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	void CancelReservation(const FRavenPoolReservationTicket& Ticket);
+
+	/**
+	 * Gets the number of objects of a reservation that are ready to be acquired.
+	 * @param Ticket The ticket returned by ReserveBurst
+	 * @return The number of ready objects, or 0 if the reservation expired or was used up
+	 */
+	UFUNCTION(BlueprintPure, Category = "Raven|Pool")
+	int32 GetReservedCount(const FRavenPoolReservationTicket& Ticket) const;
+
+	/**
+	 * Acquires a batch of objects of the specified class with a single pool lookup.
+	 * @param Class The class of objects to acquire
+	 * @param Count The number of objects to acquire
+	 * @param OutObjects Receives the acquired objects
+	 * @return The number of objects acquired
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	int32 AcquireMany(UClass* Class, int32 Count, TArray<UObject*>& OutObjects);
+
+	/**
+	 * Acquires one object of the specified class per transform and moves actors and scene components there.
+	 * @param Class The class of objects to acquire
+	 * @param Transforms The transforms to place the acquired objects at
+	 * @param OutObjects Receives the acquired objects
+	 * @return The number of objects acquired
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	int32 AcquireManyAtTransforms(UClass* Class, const TArray<FTransform>& Transforms, TArray<UObject*>& OutObjects);
+
+	/**
+	 * Releases a batch of objects back to their pools.
+	 * Consecutive objects of the same class share a single pool lookup.
+	 * @param Objects The objects to release
+	 * @return The number of objects released
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	int32 ReleaseMany(const TArray<UObject*>& Objects);
+
+	/**
+	 * Acquires an object of the specified class and returns the slot id it occupies.
+	 * The slot id can be used to release the object without an object lookup.
+	 * @param Class The class of object to acquire
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	UObject* AcquireSlot(UClass* Class, FRavenPoolSlotId& OutSlotId);
+
+	/**
+	 * Releases the object in the given slot back to its pool.
+	 * Stale slot ids (whose object was already released or removed) are ignored.
+	 * @param SlotId The slot id returned on acquisition
+	 * @return True if the object was released, false otherwise
+	 */
+	bool ReleaseSlot(const FRavenPoolSlotId& SlotId);
+
+	/**
+	 * Checks whether a slot id still refers to the acquisition it was handed out for.
+	 * @param SlotId The slot id to check
+	 * @return True if the slot is still active with the same generation
+	 */
+	bool IsSlotValid(const FRavenPoolSlotId& SlotId) const;
+
+	/**
+	 * Resolves a slot id to its object.
+	 * @param SlotId The slot id to resolve
+	 * @return The object, or nullptr if the slot id is stale
+	 */
+	UObject* ResolveSlot(const FRavenPoolSlotId& SlotId) const;
+
 	/**
 	 * Registers a factory for creating objects of a specific class.
 	 * @param Class The class to register the factory for
@@ -71,6 +288,76 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Raven|Pool")
 	int32 GetInactiveCount(UClass* ObjectClass) const;
 
+	/**
+	 * Gets detailed statistics for the pool of a specific class.
+	 * @param ObjectClass The class to check
+	 * @return The pool statistics, or empty statistics if no pool exists
+	 */
+	UFUNCTION(BlueprintPure, Category = "Raven|Pool")
+	FRavenPoolStats GetPoolStats(UClass* ObjectClass) const;
+
+	/**
+	 * Gets the counters of the pool for a specific class, e.g. for a telemetry thread.
+	 * Must be called on the game thread; the returned counters may then be read from any thread.
+	 * @param ObjectClass The class to check
+	 * @return The pool counters, or nullptr if no pool exists
+	 */
+	TSharedPtr<const FRavenPoolCounters, ESPMode::ThreadSafe> GetPoolCounters(UClass* ObjectClass) const;
+
+	/**
+	 * Queues objects of a class to be pre-created over the next frames within the pre-warm budget of the
+	 * developer settings. Progress is reported through OnPreWarmProgress.
+	 * @param ObjectClass The class to pre-warm
+	 * @param Count The number of objects to pre-create
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	void PreWarmAsync(UClass* ObjectClass, int32 Count);
+
+	/**
+	 * Whether objects queued through PreWarmAsync or by pools configured to pre-warm asynchronously are still
+	 * waiting to be created.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Raven|Pool")
+	bool IsPreWarming() const { return PreWarmQueued > 0; }
+
+	/**
+	 * Gets the progress of the asynchronous pre-warming in progress.
+	 * @return The fraction of queued objects created, 1 if nothing is being pre-warmed
+	 */
+	UFUNCTION(BlueprintPure, Category = "Raven|Pool")
+	float GetPreWarmProgress() const { return PreWarmQueued > 0 ? static_cast<float>(PreWarmDone) / PreWarmQueued : 1.0f; }
+
+	/** Broadcast every frame while pre-warming asynchronously, and once more when NumCreated reaches NumTotal */
+	UPROPERTY(BlueprintAssignable, Category = "Raven|Pool")
+	FRavenPoolPreWarmProgressDelegate OnPreWarmProgress;
+
+	/**
+	 * Whether the class or factory of a configured pool is still being loaded. Acquisitions of the class fail
+	 * until it is, except asynchronous ones, which wait for the pool.
+	 * @param ObjectClass The pooled class
+	 * @return True while the pool's assets are loading
+	 */
+	UFUNCTION(BlueprintPure, Category = "Raven|Pool")
+	bool IsPoolLoading(const UClass* ObjectClass) const;
+
+	/**
+	 * Whether any configured pool is still being loaded.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Raven|Pool")
+	bool IsLoadingPools() const { return !PoolLoadHandles.IsEmpty(); }
+
+	/** Broadcast when a configured pool finished loading and is ready to be acquired from */
+	UPROPERTY(BlueprintAssignable, Category = "Raven|Pool")
+	FRavenPoolLoadedDelegate OnPoolLoaded;
+
+	/**
+	 * Writes the pool usage recorded so far in this world to a new run file in Saved/RavenPool/Runs.
+	 * Usage is only recorded if enabled in the developer settings; the world writes its run when it ends anyway.
+	 * @return True if the run was written
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Raven|Pool")
+	bool SaveUsageProfile();
+
 	/**
 	 * Clears all inactive objects from the pool for a specific class.
 	 * @param ObjectClass The class to clear inactive objects for
@@ -96,6 +383,9 @@ protected:
 	virtual bool IsTickableInEditor() const override { return false; }
 	virtual bool IsTickableWhenPaused() const override { return false; }
 
+public:
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 protected:
 	/** Gets or creates a pool for the specified class */
 	virtual FRavenPool* GetPool(UClass* ObjectClass);
@@ -103,12 +393,119 @@ protected:
 	/** Gets the pool for a specific class (for statistics/debugging) */
 	const FRavenPool* GetPoolForClass(UClass* ObjectClass) const;
 
+	/** Gets the pool with the given id, or nullptr if there is none */
+	FRavenPool* GetPoolById(int32 PoolId);
+	const FRavenPool* GetPoolById(int32 PoolId) const;
+
+	/** Releases a batch of slot ids, looking up one pool per run of ids of the same pool */
+	int32 ReleaseSlots(TConstArrayView<FRavenPoolSlotId> SlotIds);
+
+	/** Releases the slots scheduled for the end of the frame */
+	void HandleEndFrame();
+
+	/** Releases everything queued by ReleaseDeferred and ReleaseSlotDeferred */
+	void DrainDeferredReleases();
+
+	/** Gets the long package name of this subsystem's map, without any PIE prefix */
+	FString GetMapName() const;
+
+	/** Samples the active objects of every pool into the recorded usage */
+	void RecordUsage();
+
+	/**
+	 * Whether a configured pool is meant to be created in this subsystem's world.
+	 * @param PoolConfig The pool configuration
+	 * @return True if the configuration lists no maps or lists the current one
+	 */
+	bool IsPoolConfigUsedInWorld(const FRavenPoolConfig& PoolConfig) const;
+
+	/**
+	 * Registers the factory of a configured pool whose class and factory are loaded, then creates, configures
+	 * and pre-warms the pool.
+	 * @param PoolConfig The pool configuration
+	 */
+	void RegisterPoolConfig(const FRavenPoolConfig& PoolConfig);
+
+	/**
+	 * Brings a configured pool online once its class and factory finished loading.
+	 * @param PoolConfig Copy of the pool configuration taken when the load was requested
+	 */
+	void HandlePoolConfigLoaded(FRavenPoolConfig PoolConfig);
+
+	/**
+	 * Serves the pending asynchronous acquisitions.
+	 * @param Deadline Time after which no more objects are created this frame
+	 */
+	void ProcessAsyncAcquisitions(double Deadline);
+
 private:
-	/** All active pools */
-	UPROPERTY()
-	TArray<FRavenPool> Pools;
+	/** All active pools, indexed by pool id. Pools are heap allocated so their addresses stay stable. */
+	TArray<TUniquePtr<FRavenPool>> Pools;
+
+	/** Map from pooled class to pool id */
+	TMap<TObjectPtr<UClass>, int32> PoolIdsByClass;
+
+	/** Concurrent pools by pooled class. Pools are heap allocated so worker threads can hold on to them. */
+	TMap<TObjectPtr<UClass>, TUniquePtr<FRavenConcurrentPool>> ConcurrentPools;
+
+	/** Pending timed releases, on the world time clock */
+	FRavenPoolTimingWheel ReleaseWheel;
+
+	/** Slots to release at the end of the frame */
+	TArray<FRavenPoolSlotId> EndOfFrameReleases;
+
+	/** Scratch array for the slots released by the timing wheel each tick */
+	TArray<FRavenPoolSlotId> ExpiredReleases;
+
+	/** Handle of the end of frame callback */
+	FDelegateHandle EndFrameHandle;
+
+	/** A release queued from any thread; either the object or the slot id is set */
+	struct FDeferredRelease
+	{
+		TWeakObjectPtr<UObject> Object;
+		FRavenPoolSlotId SlotId;
+	};
+
+	/** Lock-free queue of releases pushed from any thread and drained on the game thread */
+	TQueue<FDeferredRelease, EQueueMode::Mpsc> DeferredReleases;
+
+	/** Scratch arrays for draining the deferred releases */
+	TArray<UObject*> DeferredObjects;
+	TArray<FRavenPoolSlotId> DeferredSlotIds;
+
+	/** An asynchronous acquisition waiting for its object to be created */
+	struct FPendingAsyncAcquire
+	{
+		TWeakObjectPtr<UClass> Class;
+		TUniqueFunction<void(UObject*)> OnAcquired;
+	};
+
+	/** Pending asynchronous acquisitions, served in request order */
+	TArray<FPendingAsyncAcquire> PendingAsyncAcquisitions;
+
+	/** Streamable handles of the configured pools still loading, by pooled class path */
+	TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> PoolLoadHandles;
+
+	/** Number of objects queued for asynchronous pre-warming since the last pre-warm completed */
+	int32 PreWarmQueued = 0;
+
+	/** Number of those objects already dealt with */
+	int32 PreWarmDone = 0;
+
+	/** Merged usage profile of this world's map, if one was found */
+	TOptional<FRavenPoolUsageProfile> UsageProfile;
+
+	/** Usage recorded in this world, one class entry per pool id */
+	FRavenPoolUsageProfile RecordedUsage;
+
+	/** Whether usage is being recorded */
+	bool bRecordingUsage = false;
 
 	/** Registered factories for creating pooled objects */
 	UPROPERTY()
 	TMap<TObjectPtr<UClass>, TObjectPtr<URavenPoolFactoryUObject>> Factories;
+
+	template <typename T>
+	friend class TRavenPoolRef;
 };
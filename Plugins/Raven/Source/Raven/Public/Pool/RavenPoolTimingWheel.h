@@ -0,0 +1,69 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Pool/RavenPoolTypes.h"
+
+/**
+ * Hashed timing wheel of pending pool releases.
+ * Time is split into ticks of a fixed resolution and every timer is stored in the bucket of its expiry tick,
+ * modulo the number of buckets. Scheduling is O(1) and advancing only visits the buckets of the ticks that
+ * passed, so thousands of timed objects cost about as much as the ones actually expiring.
+ * Timers are identified by slot ids and never cancelled: an object released early bumps its slot's generation,
+ * which turns its timer into a stale id that the pool ignores.
+ */
+class RAVEN_API FRavenPoolTimingWheel
+{
+public:
+	/**
+	 * @param InResolution Length of a wheel tick in seconds; timers expire up to one tick late
+	 * @param InNumBuckets Number of buckets, rounded up to a power of two
+	 */
+	explicit FRavenPoolTimingWheel(double InResolution = 1.0 / 30.0, int32 InNumBuckets = 256);
+
+	/**
+	 * Schedules the release of a slot.
+	 * @param SlotId The slot to release
+	 * @param ExpiryTime The time to release it at, on the clock passed to Advance
+	 */
+	void Schedule(const FRavenPoolSlotId& SlotId, double ExpiryTime);
+
+	/**
+	 * Advances the wheel and collects the timers that expired.
+	 * @param CurrentTime The current time, on the same clock as the expiry times
+	 * @param OutExpired Receives the slot ids of the expired timers, appended to any existing elements
+	 */
+	void Advance(double CurrentTime, TArray<FRavenPoolSlotId>& OutExpired);
+
+	/** Removes all timers */
+	void Reset();
+
+	/** Gets the number of pending timers */
+	int32 Num() const { return NumTimers; }
+
+private:
+	struct FTimer
+	{
+		FRavenPoolSlotId SlotId;
+		int64 ExpiryTick = 0;
+	};
+
+	/** Collects the expired timers of one bucket */
+	void ExpireBucket(TArray<FTimer>& Bucket, int64 UpToTick, TArray<FRavenPoolSlotId>& OutExpired);
+
+private:
+	TArray<TArray<FTimer>> Buckets;
+
+	/** Number of buckets minus one, for masking tick numbers */
+	int64 BucketMask = 0;
+
+	/** Length of a tick in seconds */
+	double Resolution = 0.0;
+
+	/** Last tick the wheel was advanced to */
+	int64 CurrentTick = 0;
+
+	/** Number of timers in all buckets */
+	int32 NumTimers = 0;
+};
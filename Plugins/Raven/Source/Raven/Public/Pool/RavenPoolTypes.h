@@ -23,7 +23,29 @@ enum class ERavenPoolAcquisitionStrategy : uint8
 	LRU UMETA(DisplayName = "LRU (Least Recently Used)"),
 
 	/** Random - selects a random inactive object */
-	Random UMETA(DisplayName = "Random")
+	Random UMETA(DisplayName = "Random"),
+
+	/** Nearest - reuses the inactive object released closest to the location requested on acquisition */
+	Nearest UMETA(DisplayName = "Nearest (Closest To Requested Location)")
+};
+
+/**
+ * Overflow policy determines what an acquisition does when the pool has reached its max size and has no inactive object.
+ */
+UENUM(BlueprintType)
+enum class ERavenPoolOverflowPolicy : uint8
+{
+	/** Fail - the acquisition returns nullptr */
+	Fail UMETA(DisplayName = "Fail"),
+
+	/** Recycle Oldest - releases the active object acquired the longest ago and hands it out again */
+	RecycleOldest UMETA(DisplayName = "Recycle Oldest Active"),
+
+	/**
+	 * Spawn Transient - creates an object outside the pool that is destroyed when it is released. Acquisitions
+	 * that hand out a slot id (handles, owners, lifetimes) fail instead, as transient objects have no slot.
+	 */
+	SpawnTransient UMETA(DisplayName = "Spawn Transient")
 };
 
 /**
@@ -46,13 +68,119 @@ struct RAVEN_API FRavenPoolPolicy
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy", meta = (ClampMin = "0"))
 	int32 MinPoolSize = 0;
 
+	/**
+	 * Number of free objects below which the pool is topped up in the background, within the pre-warm budget
+	 * of the subsystem (0 = disabled)
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy", meta = (ClampMin = "0"))
+	int32 LowWatermark = 0;
+
+	/** Number of free objects background replenishment tops the pool up to, never less than the low watermark */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy", meta = (ClampMin = "0", EditCondition = "LowWatermark > 0"))
+	int32 HighWatermark = 0;
+
+	/** Interval for returning objects whose owner was garbage collected (0 = only on ReleaseAllForOwner) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy", meta = (ClampMin = "0"))
+	float OwnerReclaimInterval = 1.0f;
+
+	/**
+	 * Size the pool from observed demand instead of by hand. Peak concurrency and acquisition rate are tracked
+	 * with decaying averages and the pool is grown in the background or trimmed towards the resulting target.
+	 * MinPoolSize stays the lower bound, idle expiry and shrinking never go below the target.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Adaptive")
+	bool bAdaptiveSizing = false;
+
+	/** Time in seconds after which a past sample counts half as much towards the demand averages */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Adaptive", meta = (ClampMin = "0.1", EditCondition = "bAdaptiveSizing"))
+	float AdaptiveHalfLife = 30.0f;
+
+	/** Fraction of the estimated peak concurrency kept on top of it */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Adaptive", meta = (ClampMin = "0", EditCondition = "bAdaptiveSizing"))
+	float AdaptiveHeadroom = 0.25f;
+
+	/** Fraction by which demand has to fall below the target before the target is lowered */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Adaptive", meta = (ClampMin = "0", ClampMax = "1", EditCondition = "bAdaptiveSizing"))
+	float AdaptiveHysteresis = 0.25f;
+
 	/** Enable validation checks on pooled objects */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy")
 	bool bEnableValidation = true;
 
+	/**
+	 * Guarantee that acquiring and releasing on a warm pool does no heap allocation.
+	 * All bookkeeping is reserved up front (up to the max pool size, if set) and in non-shipping builds run with
+	 * -RavenPoolAllocationChecks, any allocation on those paths, including in the pool hooks, raises an ensure.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy")
+	bool bNoAllocation = false;
+
 	/** Acquisition strategy for selecting objects from the pool */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy")
 	ERavenPoolAcquisitionStrategy AcquisitionStrategy = ERavenPoolAcquisitionStrategy::FIFO;
+
+	/** Cell size of the spatial hash used by the Nearest acquisition strategy */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy", meta = (ClampMin = "1", EditCondition = "AcquisitionStrategy == ERavenPoolAcquisitionStrategy::Nearest"))
+	float SpatialHashCellSize = 1000.0f;
+
+	/** What acquisitions do once the pool has reached its max size and has no inactive object */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Policy")
+	ERavenPoolOverflowPolicy OverflowPolicy = ERavenPoolOverflowPolicy::Fail;
+};
+
+/**
+ * Identifies a single slot in a pool.
+ * The generation is bumped whenever the slot's object is released or removed, so an id that
+ * outlived a reuse of its slot can be detected without looking up the object.
+ */
+USTRUCT(BlueprintType)
+struct RAVEN_API FRavenPoolSlotId
+{
+	GENERATED_BODY()
+
+	/** Id of the pool owning the slot */
+	UPROPERTY()
+	int32 PoolId = INDEX_NONE;
+
+	/** Index of the slot within the pool */
+	UPROPERTY()
+	int32 Slot = INDEX_NONE;
+
+	/** Generation of the slot at the time the id was handed out */
+	UPROPERTY()
+	uint32 Generation = 0;
+
+	/** Whether this id refers to a slot at all (it may still be stale) */
+	bool IsSet() const { return PoolId != INDEX_NONE && Slot != INDEX_NONE; }
+
+	friend bool operator==(const FRavenPoolSlotId& A, const FRavenPoolSlotId& B)
+	{
+		return A.PoolId == B.PoolId && A.Slot == B.Slot && A.Generation == B.Generation;
+	}
+};
+
+/**
+ * Identifies a burst reservation of a pool, see URavenPoolSubsystem::ReserveBurst.
+ */
+USTRUCT(BlueprintType)
+struct RAVEN_API FRavenPoolReservationTicket
+{
+	GENERATED_BODY()
+
+	/** Id of the pool holding the reservation */
+	UPROPERTY()
+	int32 PoolId = INDEX_NONE;
+
+	/** Index of the reservation within the pool */
+	UPROPERTY()
+	int32 Reservation = INDEX_NONE;
+
+	/** Serial number of the reservation, so a ticket of an expired reservation never matches a newer one */
+	UPROPERTY()
+	uint32 Serial = 0;
+
+	/** Whether this ticket refers to a reservation at all (it may have expired) */
+	bool IsSet() const { return PoolId != INDEX_NONE && Reservation != INDEX_NONE; }
 };
 
 /**
@@ -119,24 +247,59 @@ struct RAVEN_API FRavenPoolStats
 
 	/** Total number of objects created over lifetime */
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
-	int32 TotalCreated = 0;
+	int64 TotalCreated = 0;
+
+	/** Total number of objects destroyed over lifetime */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 TotalDestroyed = 0;
 
 	/** Total number of acquisitions */
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
-	int32 TotalAcquisitions = 0;
+	int64 TotalAcquisitions = 0;
 
 	/** Total number of releases */
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
-	int32 TotalReleases = 0;
+	int64 TotalReleases = 0;
 
 	/** Number of objects reused from pool */
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
-	int32 TotalReuses = 0;
+	int64 TotalReuses = 0;
+
+	/** Number of acquisitions that found no free object and had to create one synchronously */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 TotalSynchronousCreations = 0;
 
 	/** Peak pool size */
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
 	int32 PeakPoolSize = 0;
 
+	/** Number of transient objects currently alive, not counted in the pool size */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 TransientCount = 0;
+
+	/** Number of acquisitions that failed because the pool was full */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 TotalOverflowFailures = 0;
+
+	/** Number of active objects recycled because the pool was full */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 TotalOverflowRecycles = 0;
+
+	/** Number of transient objects created because the pool was full */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 TotalOverflowTransients = 0;
+
+	/** Size adaptive sizing currently keeps the pool at (0 if adaptive sizing is disabled) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 AdaptiveTargetSize = 0;
+
+	/**
+	 * Number of reuses of objects idle for longer than the policy's MaxIdleTime, which adaptive sizing kept
+	 * instead of destroying them and creating new ones
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 TotalCyclesAvoided = 0;
+
 	/** Usage percentage (active / total) */
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
 	float UsagePercent = 0.0f;
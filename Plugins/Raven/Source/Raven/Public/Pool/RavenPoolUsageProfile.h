@@ -0,0 +1,112 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+#include "RavenPoolUsageProfile.generated.h"
+
+/**
+ * Recorded usage of one pooled class on one map.
+ */
+USTRUCT()
+struct RAVEN_API FRavenPoolClassUsage
+{
+	GENERATED_BODY()
+
+	/** The pooled class */
+	UPROPERTY()
+	FSoftClassPath Class;
+
+	/** Highest number of objects active at once */
+	UPROPERTY()
+	int32 PeakActive = 0;
+
+	/** Number of acquisitions, summed over the merged runs */
+	UPROPERTY()
+	int64 Acquisitions = 0;
+
+	/** Highest number of objects active at once in each sample window since the map started */
+	UPROPERTY()
+	TArray<int32> ActiveCurve;
+};
+
+/**
+ * Pool usage recorded on one map, either a single play session or several merged together.
+ * Stored as JSON: every session writes a run to the Saved directory, and the merged profiles the subsystem
+ * pre-warms from are read from the Content directory. Merged profiles are plain files, so packaged builds need
+ * RavenPool/Profiles in the project's additional non-asset directories to package.
+ */
+USTRUCT()
+struct RAVEN_API FRavenPoolUsageProfile
+{
+	GENERATED_BODY()
+
+	/** Long package name of the map */
+	UPROPERTY()
+	FString Map;
+
+	/** Length of a sample window of the active curves in seconds */
+	UPROPERTY()
+	float SampleInterval = 5.0f;
+
+	/** Number of play sessions merged into the profile */
+	UPROPERTY()
+	int32 NumRuns = 1;
+
+	/** Usage of every class pooled on the map */
+	UPROPERTY()
+	TArray<FRavenPoolClassUsage> Classes;
+
+	/**
+	 * Finds the usage of a class.
+	 * @param Class The pooled class
+	 * @return The usage, or nullptr if the class wasn't pooled on the map
+	 */
+	const FRavenPoolClassUsage* FindClass(const FSoftObjectPath& Class) const;
+
+	/**
+	 * Gets or adds the usage of a class.
+	 * @param Class The pooled class
+	 * @return The usage
+	 */
+	FRavenPoolClassUsage& FindOrAddClass(const FSoftClassPath& Class);
+
+	/**
+	 * Merges another profile of the same map into this one. Peaks and curves keep the highest value of either,
+	 * so the result covers the busiest run. Profiles of other maps or with another sample interval are skipped
+	 * with a warning.
+	 * @param Other The profile to merge in
+	 * @return True if the profile was merged
+	 */
+	bool Merge(const FRavenPoolUsageProfile& Other);
+
+	/**
+	 * Writes the profile to a JSON file.
+	 * @param Filename The file to write
+	 * @return True if the file was written
+	 */
+	bool SaveToFile(const FString& Filename) const;
+
+	/**
+	 * Reads a profile from a JSON file.
+	 * @param Filename The file to read
+	 * @param OutProfile Receives the profile
+	 * @return True if the file existed and could be parsed
+	 */
+	static bool LoadFromFile(const FString& Filename, FRavenPoolUsageProfile& OutProfile);
+
+	/** Gets the directory single play sessions are recorded to */
+	static FString GetRunDirectory();
+
+	/** Gets the directory of the merged profiles the pool subsystem pre-warms from */
+	static FString GetProfileDirectory();
+
+	/**
+	 * Gets the file of the merged profile of a map.
+	 * @param Map Long package name of the map
+	 * @return The profile file, inside GetProfileDirectory()
+	 */
+	static FString GetProfileFilename(const FString& Map);
+};
@@ -0,0 +1,331 @@
+// RavenStorm Copyright @ 2025-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RavenPoolRef.h"
+#include "RavenPoolStats.h"
+#include "RavenPoolAllocationCheck.h"
+#include "Pool/Factory/RavenPoolFactoryUObject.h"
+#include "Pool/Interface/Poolable.h"
+#include "Pool/Strategy/RavenPoolStrategy.h"
+
+/**
+ * Compile-time reset logic of a natively typed pool.
+ * By default, classes implementing IPoolable in C++ get their native hook implementations called directly,
+ * without UFunction dispatch (Blueprint overrides of the hooks are therefore not called), and all other
+ * classes get no hooks at all. Specialize for a class to customize its reset logic.
+ */
+template <typename T>
+struct TRavenPoolResetTraits
+{
+	static constexpr bool bNativePoolable = TIsDerivedFrom<T, IPoolable>::Value;
+
+	static void OnAcquired(T* Object)
+	{
+		if constexpr (bNativePoolable)
+		{
+			Object->OnAcquiredFromPool_Implementation();
+		}
+	}
+
+	static void OnReleased(T* Object)
+	{
+		if constexpr (bNativePoolable)
+		{
+			Object->OnReturnedToPool_Implementation();
+		}
+	}
+
+	static bool IsValidForReuse(const T* Object)
+	{
+		if constexpr (bNativePoolable)
+		{
+			return Object->IsValidForReuse_Implementation();
+		}
+		return true;
+	}
+};
+
+/**
+ * Typed pool factory that forwards to the pool's shared factory object.
+ * Used by default so objects created through the typed pool and through the subsystem are interchangeable.
+ */
+struct FRavenPoolSharedFactory
+{
+	static UObject* Create(URavenPoolFactoryUObject& SharedFactory, UClass* Class) { return SharedFactory.CreatePoolObject(Class); }
+	static void PrepareForUsage(URavenPoolFactoryUObject& SharedFactory, UObject* Object) { SharedFactory.PrepareForUsage(Object); }
+	static void PrepareForStorage(URavenPoolFactoryUObject& SharedFactory, UObject* Object) { SharedFactory.PrepareForStorage(Object); }
+};
+
+/**
+ * Typed pool factory for plain objects that need no preparation beyond their reset traits.
+ * Creates objects the same way as the default URavenPoolFactoryUObject.
+ */
+struct FRavenPoolNativeFactory
+{
+	static UObject* Create(URavenPoolFactoryUObject& SharedFactory, UClass* Class) { return NewObject<UObject>(SharedFactory.GetOuter(), Class); }
+	static void PrepareForUsage(URavenPoolFactoryUObject& SharedFactory, UObject* Object) {}
+	static void PrepareForStorage(URavenPoolFactoryUObject& SharedFactory, UObject* Object) {}
+};
+
+/**
+ * Natively typed front end of a pool for C++-only hot classes.
+ * The acquisition strategy (one of the FRavenPool*Selector types) and the factory hooks are template
+ * parameters and the reset logic comes from TRavenPoolResetTraits, so acquire and release are resolved at
+ * compile time instead of going through the virtual strategy, BlueprintNativeEvent factory calls and
+ * Implements<UPoolable>() checks.
+ * Storage, counters and slot ids are shared with the underlying FRavenPool, so the same pool can still be
+ * used from Blueprint and through the subsystem. The pool's own acquisition strategy is kept up to date but
+ * the typed front end selects objects with StrategyType.
+ * Objects destroyed by the pool (validation, shrinking, idle expiry) always go through the shared factory.
+ *
+ * FactoryType must provide:
+ *   static UObject* Create(URavenPoolFactoryUObject& SharedFactory, UClass* Class);
+ *   static void PrepareForUsage(URavenPoolFactoryUObject& SharedFactory, T* Object);
+ *   static void PrepareForStorage(URavenPoolFactoryUObject& SharedFactory, T* Object);
+ */
+template <typename T, typename StrategyType = FRavenPoolFIFOSelector, typename FactoryType = FRavenPoolSharedFactory>
+class TRavenTypedPool
+{
+public:
+	TRavenTypedPool() = default;
+
+	explicit TRavenTypedPool(const TRavenPoolRef<T>& InPoolRef)
+		: PoolRef(InPoolRef)
+	{
+	}
+
+	/**
+	 * Resolves the typed pool for a class, creating the underlying pool if needed.
+	 * @param InSubsystem The pool subsystem owning the pool
+	 * @param InPoolClass The pooled class, which must be T or a subclass of it
+	 * @return The typed pool, or an invalid one if no pool could be resolved
+	 */
+	static TRavenTypedPool Resolve(URavenPoolSubsystem* InSubsystem, UClass* InPoolClass = T::StaticClass())
+	{
+		return TRavenTypedPool(TRavenPoolRef<T>::Resolve(InSubsystem, InPoolClass));
+	}
+
+	/**
+	 * Acquires an object from the pool.
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	T* Acquire()
+	{
+		FRavenPoolSlotId SlotId;
+		return AcquireInternal([](T*) {}, SlotId, true);
+	}
+
+	/**
+	 * Acquires an object from the pool and returns the id of the slot it occupies.
+	 * Never hands out a transient object, see FRavenPool::Acquire.
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	T* Acquire(FRavenPoolSlotId& OutSlotId)
+	{
+		return AcquireInternal([](T*) {}, OutSlotId, false);
+	}
+
+	/**
+	 * Acquires an object from the pool, placing it at a transform and initializing it before it is prepared for
+	 * usage. See FRavenPool::AcquireAt.
+	 * @param Transform The transform to place the object at
+	 * @param Initializer Called with the dormant object after placing it
+	 * @param OutSlotId Receives the slot id of the acquired object
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	T* AcquireAt(const FTransform& Transform, TFunctionRef<void(T*)> Initializer, FRavenPoolSlotId& OutSlotId)
+	{
+		return AcquireInternal([&Transform, &Initializer](T* Object)
+		{
+			FRavenPool::ApplyTransform(Object, Transform);
+			Initializer(Object);
+		}, OutSlotId, false);
+	}
+
+	/**
+	 * Releases an object back to the pool.
+	 * @param Object The object to release
+	 * @return True if the object was released
+	 */
+	bool Release(T* Object)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Pool_Release);
+
+		FRavenPool* Pool = PoolRef.GetPool();
+		if (!Pool || !::IsValid(Pool->Factory) || !::IsValid(Object))
+		{
+			return false;
+		}
+
+		const int32* IndexPtr = Pool->ObjectToIndex.Find(Object);
+		if (!IndexPtr)
+		{
+			return !Pool->TransientObjects.IsEmpty() && Pool->ReleaseTransient(Object);
+		}
+
+		if (!Pool->ActiveSlots[*IndexPtr])
+		{
+			return false;
+		}
+		return ReleaseSlot(*Pool, *IndexPtr, Object);
+	}
+
+	/**
+	 * Releases the object in the given slot back to the pool without an object lookup.
+	 * @param SlotId The slot id returned on acquisition
+	 * @return True if the object was released, false if the id is stale
+	 */
+	bool Release(const FRavenPoolSlotId& SlotId)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Pool_Release);
+
+		FRavenPool* Pool = PoolRef.GetPool();
+		if (!Pool || !::IsValid(Pool->Factory) || !Pool->IsValidSlotId(SlotId))
+		{
+			return false;
+		}
+
+		T* Object = GetObject(*Pool, SlotId.Slot);
+		return ::IsValid(Object) && ReleaseSlot(*Pool, SlotId.Slot, Object);
+	}
+
+	/**
+	 * Checks if the underlying pool still exists.
+	 * @return True if the pool can be used
+	 */
+	bool IsValid() const
+	{
+		return PoolRef.IsValid();
+	}
+
+	/**
+	 * Gets the underlying pool, e.g. for statistics.
+	 * @return The pool, or nullptr if invalid
+	 */
+	FRavenPool* GetPool() const
+	{
+		return PoolRef.GetPool();
+	}
+
+private:
+	/**
+	 * Acquires an object, reusing an inactive one or creating a new one.
+	 * @param PrepareDormant Called with the object before it is prepared for usage
+	 * @param OutSlotId Receives the slot id of the acquired object, left unset for transient objects
+	 * @param bAllowTransient Whether a full pool may hand out a transient object under the SpawnTransient policy
+	 * @return The acquired object, or nullptr if acquisition fails
+	 */
+	template <typename PrepareType>
+	T* AcquireInternal(PrepareType&& PrepareDormant, FRavenPoolSlotId& OutSlotId, const bool bAllowTransient)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Pool_Acquire);
+
+		OutSlotId = FRavenPoolSlotId();
+
+		FRavenPool* Pool = PoolRef.GetPool();
+		if (!Pool || !::IsValid(Pool->Factory))
+		{
+			return nullptr;
+		}
+
+		// Try to reuse an inactive object from the pool, discarding any that fail validation
+		int32 Index = StrategyType::Select(Pool->FreeList);
+		while (Index != INDEX_NONE && Pool->Policy.bEnableValidation && !IsValidForReuse(GetObject(*Pool, Index)))
+		{
+			Pool->DestroySlot(Index);
+			Index = StrategyType::Select(Pool->FreeList);
+		}
+
+		// A full pool applies its overflow policy; recycled and transient objects go through the shared hooks
+		if (Index == INDEX_NONE && !Pool->HasCapacity())
+		{
+			if (Pool->Policy.OverflowPolicy == ERavenPoolOverflowPolicy::SpawnTransient && bAllowTransient)
+			{
+				T* Object = Cast<T>(Pool->CreateTransientObject());
+				if (Object)
+				{
+					PrepareDormant(Object);
+					PrepareForUsage(*Pool, Object);
+				}
+				return Object;
+			}
+
+			if (Pool->Policy.OverflowPolicy == ERavenPoolOverflowPolicy::RecycleOldest)
+			{
+				Index = Pool->RecycleOldestActive(FPlatformTime::Seconds());
+			}
+
+			if (Index == INDEX_NONE)
+			{
+				Pool->ReportOverflowFailure();
+				return nullptr;
+			}
+		}
+
+		if (Index != INDEX_NONE)
+		{
+			RAVEN_POOL_NO_ALLOCATION_SCOPE(Pool->Policy.bNoAllocation, "TRavenTypedPool::Acquire");
+
+			T* Object = GetObject(*Pool, Index);
+			Pool->ActivateSlot(Index, FPlatformTime::Seconds());
+			PrepareDormant(Object);
+			PrepareForUsage(*Pool, Object);
+
+			OutSlotId = Pool->MakeSlotId(Index);
+			return Object;
+		}
+
+		// No inactive object found, create a new one
+		UObject* Created = FactoryType::Create(*Pool->Factory, Pool->ObjectClass);
+		T* Object = Cast<T>(Created);
+		if (!::IsValid(Object))
+		{
+			if (Created)
+			{
+				Pool->Factory->DestroyPoolObject(Created);
+			}
+			return nullptr;
+		}
+
+		Index = Pool->AllocateSlot(Object, true, FPlatformTime::Seconds());
+		PrepareDormant(Object);
+		PrepareForUsage(*Pool, Object);
+
+		OutSlotId = Pool->MakeSlotId(Index);
+		return Object;
+	}
+
+	static T* GetObject(const FRavenPool& Pool, const int32 Index)
+	{
+		// The pool class was checked to be a T when the reference was resolved
+		return static_cast<T*>(Pool.Objects[Index].Get());
+	}
+
+	static bool IsValidForReuse(const T* Object)
+	{
+		return ::IsValid(Object) && TRavenPoolResetTraits<T>::IsValidForReuse(Object);
+	}
+
+	static void PrepareForUsage(FRavenPool& Pool, T* Object)
+	{
+		TRavenPoolResetTraits<T>::OnAcquired(Object);
+		FactoryType::PrepareForUsage(*Pool.Factory, Object);
+	}
+
+	static bool ReleaseSlot(FRavenPool& Pool, const int32 Index, T* Object)
+	{
+		RAVEN_POOL_NO_ALLOCATION_SCOPE(Pool.Policy.bNoAllocation, "TRavenTypedPool::Release");
+
+		Pool.DeactivateSlot(Index, FPlatformTime::Seconds());
+
+		TRavenPoolResetTraits<T>::OnReleased(Object);
+		FactoryType::PrepareForStorage(*Pool.Factory, Object);
+		return true;
+	}
+
+private:
+	TRavenPoolRef<T> PoolRef;
+};
@@ -4,9 +4,36 @@
 
 #include "CoreMinimal.h"
 #include "Pool/RavenPoolTypes.h"
+#include "Pool/RavenPoolFreeList.h"
 
 struct FRavenPoolEntry;
 
+/**
+ * Compile-time acquisition strategies for natively typed pools (see TRavenTypedPool).
+ * Each selects an inactive entry straight from the pool's free list and is inlined at the call site.
+ * The virtual strategies below forward to them.
+ */
+struct FRavenPoolFIFOSelector
+{
+	/** Selects the oldest released entry */
+	static int32 Select(const FRavenPoolFreeList& FreeList) { return FreeList.GetOldest(); }
+};
+
+struct FRavenPoolLIFOSelector
+{
+	/** Selects the most recently released entry */
+	static int32 Select(const FRavenPoolFreeList& FreeList) { return FreeList.GetNewest(); }
+};
+
+struct FRavenPoolRandomSelector
+{
+	/** Selects a random inactive entry */
+	static int32 Select(const FRavenPoolFreeList& FreeList)
+	{
+		return FreeList.IsEmpty() ? INDEX_NONE : FreeList.GetAt(FMath::RandRange(0, FreeList.Num() - 1));
+	}
+};
+
 /**
  * Base interface for pool acquisition strategies.
  * Determines how objects are selected from the pool when acquired.
@@ -19,10 +46,49 @@ public:
 	/**
 	 * Finds an inactive object from the pool.
 	 * @param Pool The pool entries to search
-	 * @param InactiveIndices Pre-computed indices of inactive entries for faster lookup
+	 * @param FreeList The pool's free list, ordered from oldest to most recently released entry
+	 * @return Index of the selected entry, or INDEX_NONE if none available
+	 */
+	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList) = 0;
+
+	/**
+	 * Finds an inactive object for use at a specific location.
+	 * Strategies that don't care about locations ignore it.
+	 * @param Pool The pool entries to search
+	 * @param FreeList The pool's free list, ordered from oldest to most recently released entry
+	 * @param Location The location the object is wanted at
 	 * @return Index of the selected entry, or INDEX_NONE if none available
 	 */
-	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices) = 0;
+	virtual int32 FindInactiveObjectNear(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList, const FVector& Location)
+	{
+		return FindInactiveObject(Pool, FreeList);
+	}
+
+	/**
+	 * Whether the strategy needs the location of every object that becomes available (see SetObjectLocation).
+	 * @return True if locations must be provided
+	 */
+	virtual bool NeedsLocations() const { return false; }
+
+	/**
+	 * Called right before OnObjectReleased with the location the object was released at, if NeedsLocations().
+	 * @param Index The index of the released object
+	 * @param Location The location of the object
+	 */
+	virtual void SetObjectLocation(int32 Index, const FVector& Location) {}
+
+	/**
+	 * Whether the strategy keeps its own state and needs the acquire/release/remove notifications.
+	 * Stateless strategies are not notified at all.
+	 * @return True if the notifications must be sent
+	 */
+	virtual bool NeedsNotifications() const { return false; }
+
+	/**
+	 * Reserves memory for the given number of pool slots, so the notifications never allocate.
+	 * @param Capacity The number of slots to reserve for
+	 */
+	virtual void Reserve(int32 Capacity) {}
 
 	/**
 	 * Called when an object is acquired, allowing the strategy to update its state.
@@ -31,10 +97,17 @@ public:
 	virtual void OnObjectAcquired(int32 Index) {}
 
 	/**
-	 * Called when an object is released, allowing the strategy to update its state.
+	 * Called when an object becomes available, either by being released or by being pre-warmed,
+	 * allowing the strategy to update its state.
 	 * @param Index The index of the released object
 	 */
 	virtual void OnObjectReleased(int32 Index) {}
+
+	/**
+	 * Called when an inactive object is removed from the pool (shrinking, idle expiry, validation).
+	 * @param Index The index of the removed object
+	 */
+	virtual void OnObjectRemoved(int32 Index) {}
 };
 
 /**
@@ -44,7 +117,7 @@ public:
 class RAVEN_API FRavenPoolFIFOStrategy : public IRavenPoolAcquisitionStrategy
 {
 public:
-	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices) override;
+	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList) override;
 };
 
 /**
@@ -54,17 +127,19 @@ public:
 class RAVEN_API FRavenPoolLIFOStrategy : public IRavenPoolAcquisitionStrategy
 {
 public:
-	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices) override;
+	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList) override;
 };
 
 /**
  * LRU (Least Recently Used) acquisition strategy.
  * Reuses the object that hasn't been used for the longest time.
+ * An inactive object was last used when it was released, so the free list's release order already is the
+ * recency order and the least recently used object is its oldest entry.
  */
 class RAVEN_API FRavenPoolLRUStrategy : public IRavenPoolAcquisitionStrategy
 {
 public:
-	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices) override;
+	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList) override;
 };
 
 /**
@@ -74,7 +149,69 @@ public:
 class RAVEN_API FRavenPoolRandomStrategy : public IRavenPoolAcquisitionStrategy
 {
 public:
-	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const TArray<int32>& InactiveIndices) override;
+	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList) override;
+};
+
+/**
+ * Nearest acquisition strategy.
+ * Reuses the inactive object released closest to the location requested on acquisition, found through a
+ * spatial hash over the release locations. Acquisitions without a location reuse the oldest released object.
+ * Pairs with the in-place storage mode of URavenPoolActorFactory, so reused actors only move a short distance.
+ * Cells link their slots intrusively and only exist while they hold a slot, so there are never more cells than
+ * inactive objects and, once reserved, releasing and acquiring don't allocate.
+ */
+class RAVEN_API FRavenPoolNearestStrategy : public IRavenPoolAcquisitionStrategy
+{
+public:
+	explicit FRavenPoolNearestStrategy(float InCellSize);
+
+	virtual int32 FindInactiveObject(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList) override;
+	virtual int32 FindInactiveObjectNear(const TArray<FRavenPoolEntry>& Pool, const FRavenPoolFreeList& FreeList, const FVector& Location) override;
+	virtual bool NeedsLocations() const override { return true; }
+	virtual void SetObjectLocation(int32 Index, const FVector& Location) override;
+	virtual bool NeedsNotifications() const override { return true; }
+	virtual void Reserve(int32 Capacity) override;
+	virtual void OnObjectAcquired(int32 Index) override;
+	virtual void OnObjectReleased(int32 Index) override;
+	virtual void OnObjectRemoved(int32 Index) override;
+
+private:
+	/** Gets the spatial hash cell containing a location */
+	FIntVector GetCell(const FVector& Location) const;
+
+	/** Removes a slot from its spatial hash cell if it is stored, removing the cell once it is empty */
+	void Unlink(int32 Index);
+
+	/**
+	 * Finds the slot of a cell's list closest to a location.
+	 * @param FirstIndex The first slot of the cell
+	 * @param Location The location the object is wanted at
+	 * @param InOutBestIndex The closest slot so far, updated if the cell has a closer one
+	 * @param InOutBestDistanceSquared Squared distance of the closest slot so far
+	 */
+	void FindNearestInCell(int32 FirstIndex, const FVector& Location, int32& InOutBestIndex, double& InOutBestDistanceSquared) const;
+
+private:
+	struct FStoredSlot
+	{
+		FVector Location = FVector::ZeroVector;
+		FIntVector Cell = FIntVector::ZeroValue;
+		int32 PrevInCell = INDEX_NONE;
+		int32 NextInCell = INDEX_NONE;
+		bool bStored = false;
+	};
+
+	/** Number of cell rings searched around the requested location before giving up on locality */
+	static constexpr int32 MaxSearchRadius = 8;
+
+	/** Release location and hash cell per pool slot */
+	TArray<FStoredSlot> Slots;
+
+	/** First inactive slot of every non-empty spatial hash cell */
+	TMap<FIntVector, int32> Cells;
+
+	/** Edge length of a hash cell */
+	float CellSize;
 };
 
 /**
@@ -89,4 +226,11 @@ public:
 	 * @return The created strategy, or nullptr if invalid type
 	 */
 	static TSharedPtr<IRavenPoolAcquisitionStrategy> CreateStrategy(ERavenPoolAcquisitionStrategy StrategyType);
+
+	/**
+	 * Creates the acquisition strategy configured by a pool policy.
+	 * @param Policy The pool policy
+	 * @return The created strategy
+	 */
+	static TSharedPtr<IRavenPoolAcquisitionStrategy> CreateStrategy(const FRavenPoolPolicy& Policy);
 };
@@ -18,6 +18,8 @@ public class Raven : ModuleRules
 		PrivateDependencyModuleNames.AddRange([
 			"CoreUObject",
 			"Engine",
+			"Json",
+			"JsonUtilities",
 			"Slate",
 			"SlateCore",
 		]);
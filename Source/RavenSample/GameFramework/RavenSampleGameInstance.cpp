@@ -6,5 +6,9 @@
 
 AActor* URavenSampleGameInstance::AcquireActor(UClass* Class)
 {
-	return Cast<AActor>(GetWorld()->GetSubsystem<URavenPoolSubsystem>()->Acquire(Class));
+	if (!ActorPool.IsBoundTo(Class))
+	{
+		ActorPool = TRavenPoolRef<AActor>::Resolve(GetWorld()->GetSubsystem<URavenPoolSubsystem>(), Class);
+	}
+	return ActorPool.Acquire();
 }
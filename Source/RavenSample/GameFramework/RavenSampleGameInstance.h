@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Engine/GameInstance.h"
 #include "GameFramework/RavenGameInstanceBase.h"
+#include "Pool/RavenPoolRef.h"
 #include "RavenSampleGameInstance.generated.h"
 
 UCLASS()
@@ -15,4 +16,8 @@ class RAVENSAMPLE_API URavenSampleGameInstance : public URavenGameInstanceBase
 public:
 	UFUNCTION(BlueprintCallable)
 	AActor* AcquireActor(UClass* Class);
+
+private:
+	/** Pool of the most recently acquired actor class, resolved once and reused while the class and world stay the same */
+	TRavenPoolRef<AActor> ActorPool;
 };